@@ -0,0 +1,151 @@
+/**
+ * @file AccelAutoRange.h
+ * @brief Automatic range selection for accelerometer reads
+ *
+ * Chooses the range argument passed to IAccelerometer::getAccel() from
+ * the peak magnitude seen during each burst of reads. Ranges only change
+ * between bursts, so samples inside a burst share one sensitivity. Going
+ * up is immediate when the peak approaches full scale; going down needs
+ * several quiet bursts in a row, which keeps the range from oscillating.
+ * Switch and clip counters are kept for tuning in the field.
+ *
+ * © 2025 Regents of the University of Minnesota. All rights reserved.
+ */
+
+#ifndef ACCEL_AUTO_RANGE_H
+#define ACCEL_AUTO_RANGE_H
+
+#include <stdint.h>
+#include "IAccelerometer.h"
+
+/**
+ * @brief Hysteretic range selector
+ */
+class AccelAutoRange {
+public:
+    static constexpr uint8_t MAX_RANGES = 8;
+
+    /**
+     * @brief Construct a selector for a sensor's range table
+     * @param fullScaleG Full scale in g for each range setting, ascending
+     * @param numRanges Number of entries in fullScaleG (at most MAX_RANGES)
+     */
+    AccelAutoRange(const float* fullScaleG, uint8_t numRanges)
+        : count(numRanges > MAX_RANGES ? MAX_RANGES : numRanges), range(0),
+          upperFraction(0.8f), lowerFraction(0.6f), clipFraction(0.99f),
+          holdBursts(4), quietBursts(0), peak(0), clippedInBurst(false),
+          switches(0), clips(0) {
+        for (uint8_t i = 0; i < count; i++) fullScale[i] = fullScaleG[i];
+    }
+
+    /**
+     * @brief Set the switching thresholds
+     *
+     * Range goes up when the burst peak reaches upper * full scale (or
+     * clips), and goes down after hold consecutive bursts whose peak stays
+     * below lower * full scale of the next range down.
+     *
+     * @param upper Fraction of the current full scale that forces a step up
+     * @param lower Fraction of the lower range's full scale that allows a step down
+     * @param hold Number of consecutive quiet bursts required before stepping down
+     */
+    void setThresholds(float upper, float lower, uint8_t hold) {
+        upperFraction = upper;
+        lowerFraction = lower;
+        holdBursts = hold;
+    }
+
+    /**
+     * @brief Read one axis at the currently selected range
+     * @param accel Accelerometer to read
+     * @param axis Axis to read (0=X, 1=Y, 2=Z)
+     * @return Acceleration in g units
+     */
+    float getAccel(IAccelerometer& accel, uint8_t axis) {
+        const float value = accel.getAccel(axis, range);
+        observe(value);
+        return value;
+    }
+
+    /**
+     * @brief Feed a value obtained by other means into the peak tracker
+     * @param value Acceleration in g units read at getRange()
+     */
+    void observe(float value) {
+        const float magnitude = (value < 0) ? -value : value;
+        if (magnitude > peak) peak = magnitude;
+        if (magnitude >= clipFraction * fullScale[range]) clippedInBurst = true;
+    }
+
+    /**
+     * @brief Close the current burst and pick the range for the next one
+     * @return true if the range changed
+     */
+    bool endBurst() {
+        const uint8_t previous = range;
+        if (clippedInBurst) clips++;
+
+        if (clippedInBurst || peak >= upperFraction * fullScale[range]) {
+            // Jump straight to the smallest range with headroom for the peak
+            while (range + 1 < count && peak >= upperFraction * fullScale[range]) range++;
+            quietBursts = 0;
+        } else if (range > 0 && peak < lowerFraction * fullScale[range - 1]) {
+            if (++quietBursts >= holdBursts) {
+                range--;
+                quietBursts = 0;
+            }
+        } else {
+            quietBursts = 0;
+        }
+
+        peak = 0;
+        clippedInBurst = false;
+        if (range == previous) return false;
+        switches++;
+        return true;
+    }
+
+    uint8_t getRange() const { return range; }
+
+    /**
+     * @brief Force a range, e.g. one restored across a sleep cycle
+     * @param newRange Range setting to use for the next burst
+     */
+    void setRange(uint8_t newRange) {
+        range = (newRange < count) ? newRange : count - 1;
+        quietBursts = 0;
+    }
+
+    /**
+     * @brief Number of range changes made by endBurst()
+     * @return Switch count
+     */
+    uint32_t getRangeSwitches() const { return switches; }
+
+    /**
+     * @brief Number of bursts that contained at least one clipped reading
+     * @return Clip event count
+     */
+    uint32_t getClipEvents() const { return clips; }
+
+    void resetCounters() {
+        switches = 0;
+        clips = 0;
+    }
+
+private:
+    float fullScale[MAX_RANGES];
+    uint8_t count;
+    uint8_t range;
+    float upperFraction;
+    float lowerFraction;
+    float clipFraction;  // Readings at or above this fraction of full scale count as clipped
+    uint8_t holdBursts;
+    uint8_t quietBursts; // Consecutive bursts that qualified for a step down
+    float peak;          // Largest magnitude in the current burst
+    bool clippedInBurst;
+    uint32_t switches;
+    uint32_t clips;
+};
+
+#endif // ACCEL_AUTO_RANGE_H
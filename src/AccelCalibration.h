@@ -0,0 +1,114 @@
+/**
+ * @file AccelCalibration.h
+ * @brief Block calibration of accelerometer samples
+ *
+ * Applies per-axis offset, per-axis gain and a 3x3 mounting/misalignment
+ * matrix to blocks of samples stored as separate X, Y and Z arrays.
+ * The corrected value for each sample is
+ *
+ *     out = M * (gain * (in - offset))
+ *
+ * which is folded into a single matrix and bias when the calibration is
+ * set, so the per-sample cost is nine multiply-adds. Uses SSE when it is
+ * available on the host and a scalar loop otherwise.
+ *
+ * © 2025 Regents of the University of Minnesota. All rights reserved.
+ */
+
+#ifndef ACCEL_CALIBRATION_H
+#define ACCEL_CALIBRATION_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define ACCEL_CALIBRATION_SSE 1
+#endif
+
+/**
+ * @brief Structure-of-arrays view of a block of XYZ samples
+ */
+struct AccelBlock {
+    float* x;     // X-axis values
+    float* y;     // Y-axis values
+    float* z;     // Z-axis values
+    size_t count; // Number of samples in each array
+};
+
+/**
+ * @brief Offset, gain and misalignment correction for sample blocks
+ */
+class AccelCalibration {
+public:
+    /**
+     * @brief Construct an identity calibration (no correction)
+     */
+    AccelCalibration() {
+        const float offset[3] = {0, 0, 0};
+        const float gain[3] = {1, 1, 1};
+        const float matrix[9] = {1, 0, 0,
+                                 0, 1, 0,
+                                 0, 0, 1};
+        set(offset, gain, matrix);
+    }
+
+    /**
+     * @brief Set the calibration parameters
+     * @param offset Per-axis offset [X, Y, Z] in g, subtracted first
+     * @param gain Per-axis gain [X, Y, Z], applied after the offset
+     * @param matrix Row-major 3x3 mounting/misalignment matrix, applied last
+     */
+    void set(const float offset[3], const float gain[3], const float matrix[9]) {
+        for (int r = 0; r < 3; r++) {
+            float b = 0;
+            for (int c = 0; c < 3; c++) {
+                m[r * 3 + c] = matrix[r * 3 + c] * gain[c];
+                b += m[r * 3 + c] * offset[c];
+            }
+            bias[r] = b;
+        }
+    }
+
+    /**
+     * @brief Calibrate a block of samples in place
+     * @param block Samples to correct
+     */
+    void apply(const AccelBlock& block) const {
+        float* x = block.x;
+        float* y = block.y;
+        float* z = block.z;
+        size_t i = 0;
+#ifdef ACCEL_CALIBRATION_SSE
+        const __m128 m0 = _mm_set1_ps(m[0]), m1 = _mm_set1_ps(m[1]), m2 = _mm_set1_ps(m[2]);
+        const __m128 m3 = _mm_set1_ps(m[3]), m4 = _mm_set1_ps(m[4]), m5 = _mm_set1_ps(m[5]);
+        const __m128 m6 = _mm_set1_ps(m[6]), m7 = _mm_set1_ps(m[7]), m8 = _mm_set1_ps(m[8]);
+        const __m128 b0 = _mm_set1_ps(bias[0]), b1 = _mm_set1_ps(bias[1]), b2 = _mm_set1_ps(bias[2]);
+        for (; i + 4 <= block.count; i += 4) {
+            const __m128 vx = _mm_loadu_ps(x + i);
+            const __m128 vy = _mm_loadu_ps(y + i);
+            const __m128 vz = _mm_loadu_ps(z + i);
+            const __m128 ox = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m0, vx), _mm_mul_ps(m1, vy)), _mm_mul_ps(m2, vz));
+            const __m128 oy = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m3, vx), _mm_mul_ps(m4, vy)), _mm_mul_ps(m5, vz));
+            const __m128 oz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m6, vx), _mm_mul_ps(m7, vy)), _mm_mul_ps(m8, vz));
+            _mm_storeu_ps(x + i, _mm_sub_ps(ox, b0));
+            _mm_storeu_ps(y + i, _mm_sub_ps(oy, b1));
+            _mm_storeu_ps(z + i, _mm_sub_ps(oz, b2));
+        }
+#endif
+        for (; i < block.count; i++) {
+            const float vx = x[i];
+            const float vy = y[i];
+            const float vz = z[i];
+            x[i] = m[0] * vx + m[1] * vy + m[2] * vz - bias[0];
+            y[i] = m[3] * vx + m[4] * vy + m[5] * vz - bias[1];
+            z[i] = m[6] * vx + m[7] * vy + m[8] * vz - bias[2];
+        }
+    }
+
+private:
+    float m[9];    // Misalignment matrix with gain folded into its columns
+    float bias[3]; // m applied to the offset, subtracted after the multiply
+};
+
+#endif // ACCEL_CALIBRATION_H
@@ -0,0 +1,207 @@
+/**
+ * @file AccelTempCompensation.h
+ * @brief Temperature-compensated accelerometer offsets
+ *
+ * Holds a piecewise-linear table of per-axis offsets on a uniform
+ * temperature grid, built from a calibration run. The table index comes
+ * straight from the temperature (no search), and offsets are only
+ * re-interpolated when getTemp() has moved by more than a tolerance, so
+ * the per-sample cost is the driver's existing offset subtraction.
+ *
+ * Typical use:
+ * @code
+ * AccelTempCompensation<16> comp(-40, 5); // -40 C to +35 C in 5 C steps
+ * // calibration: comp.addCalibrationPoint(accel.getTemp(), x, y, z - 1) ...
+ * comp.finishCalibration();
+ * ...
+ * comp.update(accel); // once per logging interval
+ * @endcode
+ *
+ * © 2025 Regents of the University of Minnesota. All rights reserved.
+ */
+
+#ifndef ACCEL_TEMP_COMPENSATION_H
+#define ACCEL_TEMP_COMPENSATION_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "IAccelerometer.h"
+
+/**
+ * @brief Offset table keyed on sensor temperature
+ *
+ * @tparam Points Number of grid points in the table (at least 2)
+ */
+template <size_t Points>
+class AccelTempCompensation {
+    static_assert(Points >= 2, "AccelTempCompensation needs at least two grid points");
+
+public:
+    /**
+     * @brief Construct an all-zero table
+     * @param minTempC Temperature of the first grid point in degrees Celsius
+     * @param stepC Spacing between grid points in degrees Celsius
+     */
+    AccelTempCompensation(float minTempC, float stepC)
+        : minTemp(minTempC), invStep(1.0f / stepC), tolerance(0.25f),
+          lastTemp(-1000.0f) {
+        for (size_t i = 0; i < Points; i++) {
+            for (int a = 0; a < 3; a++) {
+                table[i][a] = 0;
+                sums[i][a] = 0;
+            }
+            counts[i] = 0;
+        }
+        for (int a = 0; a < 3; a++) current[a] = 0;
+    }
+
+    /**
+     * @brief Set one grid point directly (e.g. from stored calibration)
+     * @param index Grid point index
+     * @param offsetX X-axis offset at this temperature in g
+     * @param offsetY Y-axis offset at this temperature in g
+     * @param offsetZ Z-axis offset at this temperature in g
+     * @return true on success, false if index is out of range
+     */
+    bool setPoint(size_t index, float offsetX, float offsetY, float offsetZ) {
+        if (index >= Points) return false;
+        table[index][0] = offsetX;
+        table[index][1] = offsetY;
+        table[index][2] = offsetZ;
+        lastTemp = -1000.0f;
+        return true;
+    }
+
+    /**
+     * @brief Add one observed offset from a calibration run
+     *
+     * Observations are averaged into the nearest grid point; call
+     * finishCalibration() once the run is complete.
+     *
+     * @param tempC Sensor temperature when the offset was observed
+     * @param offsetX Observed X-axis offset in g
+     * @param offsetY Observed Y-axis offset in g
+     * @param offsetZ Observed Z-axis offset in g
+     */
+    void addCalibrationPoint(float tempC, float offsetX, float offsetY, float offsetZ) {
+        float pos = (tempC - minTemp) * invStep + 0.5f;
+        if (pos < 0) pos = 0;
+        size_t index = (size_t)pos;
+        if (index >= Points) index = Points - 1;
+        sums[index][0] += offsetX;
+        sums[index][1] += offsetY;
+        sums[index][2] += offsetZ;
+        counts[index]++;
+    }
+
+    /**
+     * @brief Build the table from the accumulated calibration points
+     *
+     * Grid points without observations are linearly interpolated between
+     * their populated neighbours and held flat beyond the outermost ones.
+     *
+     * @return Number of grid points that had observations (0 leaves the table unchanged)
+     */
+    size_t finishCalibration() {
+        size_t populated = 0;
+        size_t prev = Points; // Last populated index, Points if none yet
+        for (size_t i = 0; i < Points; i++) {
+            if (counts[i] == 0) continue;
+            for (int a = 0; a < 3; a++) table[i][a] = (float)(sums[i][a] / counts[i]);
+            if (prev == Points) {
+                for (size_t j = 0; j < i; j++) copyPoint(j, i);
+            } else {
+                for (size_t j = prev + 1; j < i; j++) {
+                    const float f = (float)(j - prev) / (i - prev);
+                    for (int a = 0; a < 3; a++) table[j][a] = table[prev][a] + f * (table[i][a] - table[prev][a]);
+                }
+            }
+            prev = i;
+            populated++;
+        }
+        if (populated == 0) return 0;
+        for (size_t j = prev + 1; j < Points; j++) copyPoint(j, prev);
+        for (size_t i = 0; i < Points; i++) {
+            for (int a = 0; a < 3; a++) sums[i][a] = 0;
+            counts[i] = 0;
+        }
+        lastTemp = -1000.0f;
+        return populated;
+    }
+
+    /**
+     * @brief Set how far the temperature must move before offsets are recomputed
+     * @param toleranceC Temperature change in degrees Celsius
+     */
+    void setTolerance(float toleranceC) { tolerance = toleranceC; }
+
+    /**
+     * @brief Recompute the offsets for a temperature if it has moved enough
+     * @param tempC Sensor temperature in degrees Celsius
+     * @return true if the offsets were recomputed
+     */
+    bool setTemperature(float tempC) {
+        const float delta = tempC - lastTemp;
+        if (delta < tolerance && delta > -tolerance) return false;
+        lastTemp = tempC;
+        float pos = (tempC - minTemp) * invStep;
+        if (pos < 0) pos = 0;
+        if (pos > Points - 1) pos = Points - 1;
+        size_t index = (size_t)pos;
+        if (index == Points - 1) index = Points - 2;
+        const float f = pos - index;
+        for (int a = 0; a < 3; a++) {
+            current[a] = table[index][a] + f * (table[index + 1][a] - table[index][a]);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Read the sensor temperature and push updated offsets to the driver
+     * @param accel Accelerometer to compensate
+     * @return true if new offsets were written with setOffset()
+     */
+    bool update(IAccelerometer& accel) {
+        if (!setTemperature(accel.getTemp())) return false;
+        accel.setOffset(current[0], current[1], current[2]);
+        return true;
+    }
+
+    /**
+     * @brief Subtract the current offsets from uncorrected samples in place
+     * @param samples Samples to correct
+     * @param count Number of samples
+     */
+    void apply(IAccelerometer::Sample* samples, size_t count) const {
+        const float ox = current[0];
+        const float oy = current[1];
+        const float oz = current[2];
+        for (size_t i = 0; i < count; i++) {
+            samples[i].x -= ox;
+            samples[i].y -= oy;
+            samples[i].z -= oz;
+        }
+    }
+
+    /**
+     * @brief Access the offsets for the last temperature set
+     * @return Pointer to the offset array [X, Y, Z]
+     */
+    const float* getOffset() const { return current; }
+
+private:
+    void copyPoint(size_t to, size_t from) {
+        for (int a = 0; a < 3; a++) table[to][a] = table[from][a];
+    }
+
+    float minTemp;
+    float invStep;
+    float tolerance;
+    float lastTemp;           // Temperature the current offsets were computed for
+    float current[3];         // Interpolated offsets at lastTemp
+    float table[Points][3];   // Offsets at each grid point
+    double sums[Points][3];   // Calibration accumulators
+    uint32_t counts[Points];  // Calibration observations per grid point
+};
+
+#endif // ACCEL_TEMP_COMPENSATION_H
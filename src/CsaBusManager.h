@@ -0,0 +1,228 @@
+/**
+ * @file CsaBusManager.h
+ * @brief Discovery and round-robin polling of several CSAs on one bus
+ *
+ * A single ICurrentSenseAmplifier driver object is retargeted between
+ * devices with setAddress(). The manager discovers every device that
+ * answers at startup, keeps the desired configuration (sample rate,
+ * enabled channels, voltage/current directions) and the configuration
+ * last written for each address, and on every switch writes only the
+ * settings that actually differ. Polling is round-robin.
+ *
+ * Typical use:
+ * @code
+ * CsaBusManager<4> bus;
+ * bus.scan(csa);
+ * bus.setFrequency(0, 64);
+ * for (;;) {
+ *     uint8_t device = bus.pollNext(csa);
+ *     float current = csa.getCurrent(CSA_CH1);
+ *     ...
+ * }
+ * @endcode
+ *
+ * © 2025 Regents of the University of Minnesota. All rights reserved.
+ */
+
+#ifndef CSA_BUS_MANAGER_H
+#define CSA_BUS_MANAGER_H
+
+#include <stdint.h>
+#include "ICurrentSenseAmplifier.h"
+
+/**
+ * @brief Multi-device CSA manager
+ *
+ * @tparam MaxDevices Largest number of devices tracked
+ */
+template <uint8_t MaxDevices>
+class CsaBusManager {
+public:
+    static constexpr uint8_t NO_DEVICE = 0xFF;
+
+    /**
+     * @brief Configuration of one device
+     */
+    struct Config {
+        uint16_t frequency;   // Samples per second passed to setFrequency()
+        uint8_t enabled;      // Bit (1 << IChannel) set for each enabled channel
+        uint8_t voltageBidir; // Bit (1 << IChannel) set for CSA_BIDIRECTIONAL bus voltage
+        uint8_t currentBidir; // Bit (1 << IChannel) set for CSA_BIDIRECTIONAL current
+    };
+
+    CsaBusManager() : count(0), selected(NO_DEVICE), next(0), configWrites(0), addressSwitches(0) {}
+
+    /**
+     * @brief Probe a range of addresses and record every device that answers
+     *
+     * Each responding device is initialized with begin(); its current
+     * configuration is read back from the driver and used as both the
+     * desired and the applied configuration.
+     *
+     * @param csa Driver object to retarget
+     * @param firstAddress First address to probe
+     * @param lastAddress Last address to probe (inclusive)
+     * @return Number of devices found
+     */
+    uint8_t scan(ICurrentSenseAmplifier &csa, uint8_t firstAddress = 0x10, uint8_t lastAddress = 0x1F) {
+        count = 0;
+        next = 0;
+        for (uint16_t addr = firstAddress; addr <= lastAddress && count < MaxDevices; addr++) {
+            if (!csa.setAddress((uint8_t)addr)) continue;
+            addressSwitches++;
+            if (!csa.begin()) continue;
+            Device &d = devices[count];
+            d.address = (uint8_t)addr;
+            d.applied.frequency = (uint16_t)csa.getFrequency();
+            d.applied.enabled = 0x0F; // Drivers enable all channels in begin()
+            d.applied.voltageBidir = 0;
+            d.applied.currentBidir = 0;
+            for (uint8_t unit = 0; unit < CSA_NUM_CHANNELS; unit++) {
+                if (csa.getVoltageDirection(unit)) d.applied.voltageBidir |= (1 << unit);
+                if (csa.getCurrentDirection(unit)) d.applied.currentBidir |= (1 << unit);
+            }
+            d.desired = d.applied;
+            count++;
+        }
+        // The driver is left at the last address probed, so the first select() must retarget it
+        selected = NO_DEVICE;
+        return count;
+    }
+
+    uint8_t getDeviceCount() const { return count; }
+
+    /**
+     * @brief Get a device's bus address
+     * @param device Device index, 0 .. getDeviceCount() - 1
+     * @return Address, or 0 if device is out of range
+     */
+    uint8_t getAddress(uint8_t device) const { return (device < count) ? devices[device].address : 0; }
+
+    /**
+     * @brief Desired configuration of a device (may not be written yet)
+     * @param device Device index
+     * @return Configuration reference
+     */
+    const Config &getConfig(uint8_t device) const { return devices[device].desired; }
+
+    // Configuration changes are recorded here and written on the next select()
+    void setFrequency(uint8_t device, uint16_t frequency) {
+        if (device < count) devices[device].desired.frequency = frequency;
+    }
+
+    void enableChannel(uint8_t device, uint8_t unit, bool state) {
+        if (device < count) setBit(devices[device].desired.enabled, unit, state);
+    }
+
+    void setVoltageDirection(uint8_t device, uint8_t unit, bool direction) {
+        if (device < count) setBit(devices[device].desired.voltageBidir, unit, direction);
+    }
+
+    void setCurrentDirection(uint8_t device, uint8_t unit, bool direction) {
+        if (device < count) setBit(devices[device].desired.currentBidir, unit, direction);
+    }
+
+    /**
+     * @brief Point the driver at a device and bring its configuration up to date
+     * @param csa Driver object to retarget
+     * @param device Device index
+     * @return true on success
+     */
+    bool select(ICurrentSenseAmplifier &csa, uint8_t device) {
+        if (device >= count) return false;
+        Device &d = devices[device];
+        const bool switched = (selected != device);
+        if (switched) {
+            if (!csa.setAddress(d.address)) return false;
+            selected = device;
+            addressSwitches++;
+        }
+        bool ok = true;
+        if (d.desired.frequency != d.applied.frequency) {
+            if (csa.setFrequency(d.desired.frequency)) {
+                d.applied.frequency = d.desired.frequency;
+                configWrites++;
+            } else {
+                ok = false;
+            }
+        }
+        for (uint8_t unit = 0; unit < CSA_NUM_CHANNELS; unit++) {
+            const uint8_t bit = 1 << unit;
+            if ((d.desired.enabled ^ d.applied.enabled) & bit) {
+                const bool state = d.desired.enabled & bit;
+                if (csa.enableChannel(unit, state)) {
+                    setBit(d.applied.enabled, unit, state);
+                    configWrites++;
+                } else {
+                    ok = false;
+                }
+            }
+            // Directions also live in the shared driver object, which another device may
+            // have changed; only query it after a switch
+            const bool voltage = d.desired.voltageBidir & bit;
+            if (((d.desired.voltageBidir ^ d.applied.voltageBidir) & bit) ||
+                (switched && csa.getVoltageDirection(unit) != voltage)) {
+                csa.setVoltageDirection(unit, voltage);
+                setBit(d.applied.voltageBidir, unit, voltage);
+                configWrites++;
+            }
+            const bool current = d.desired.currentBidir & bit;
+            if (((d.desired.currentBidir ^ d.applied.currentBidir) & bit) ||
+                (switched && csa.getCurrentDirection(unit) != current)) {
+                csa.setCurrentDirection(unit, current);
+                setBit(d.applied.currentBidir, unit, current);
+                configWrites++;
+            }
+        }
+        return ok;
+    }
+
+    /**
+     * @brief Select the next device in round-robin order
+     * @param csa Driver object to retarget
+     * @return Index of the selected device, or NO_DEVICE if none were found or selection failed
+     */
+    uint8_t pollNext(ICurrentSenseAmplifier &csa) {
+        if (count == 0) return NO_DEVICE;
+        const uint8_t device = next;
+        next = (next + 1 == count) ? 0 : next + 1;
+        return select(csa, device) ? device : NO_DEVICE;
+    }
+
+    /**
+     * @brief Number of configuration writes issued by select()
+     * @return Write count
+     */
+    uint32_t getConfigWrites() const { return configWrites; }
+
+    /**
+     * @brief Number of setAddress() calls issued
+     * @return Switch count
+     */
+    uint32_t getAddressSwitches() const { return addressSwitches; }
+
+private:
+    struct Device {
+        uint8_t address;
+        Config desired; // Configuration requested by the application
+        Config applied; // Configuration last written to the device
+    };
+
+    static void setBit(uint8_t &mask, uint8_t unit, bool state) {
+        if (unit >= CSA_NUM_CHANNELS) return;
+        if (state) {
+            mask |= (1 << unit);
+        } else {
+            mask &= ~(1 << unit);
+        }
+    }
+
+    Device devices[MaxDevices];
+    uint8_t count;
+    uint8_t selected; // Device the driver currently points at
+    uint8_t next;     // Next device for pollNext()
+    uint32_t configWrites;
+    uint32_t addressSwitches;
+};
+
+#endif // CSA_BUS_MANAGER_H
@@ -0,0 +1,167 @@
+/**
+ * @file CsaCapture.h
+ * @brief High-rate current capture with decimation for transient debugging
+ *
+ * Runs a CSA channel at CSA_SPS_1024, hands raw current samples from the
+ * sampling context (timer interrupt or high-priority thread) to the
+ * logging context through a SampleRing, and decimates them there with a
+ * first-order CIC (boxcar) stage to a loggable rate. Every decimated bin
+ * keeps the minimum and maximum raw sample alongside the mean, so short
+ * spikes such as modem bursts or GPS acquisition survive decimation.
+ *
+ * sample() refreshes the device with update() (without clearing, so a
+ * CsaEnergyAccumulator sharing the device keeps its hardware accumulator)
+ * before every read, so each raw sample is a new conversion rather than
+ * the last latched one.
+ *
+ * Typical use:
+ * @code
+ * CsaCapture<512> capture(CSA_CH2, 64); // 1024 SPS -> 16 bins/s
+ * capture.start(csa);
+ * // sampling context, about every 1 ms:
+ * capture.sample(csa, micros());
+ * // logging context:
+ * CsaCapture<512>::Bin bins[8];
+ * size_t n = capture.drain(bins, 8);
+ * @endcode
+ *
+ * © 2025 Regents of the University of Minnesota. All rights reserved.
+ */
+
+#ifndef CSA_CAPTURE_H
+#define CSA_CAPTURE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "ICurrentSenseAmplifier.h"
+#include "SampleRing.h"
+
+/**
+ * @brief Streaming capture and decimation of one CSA channel
+ *
+ * @tparam RingSize Raw samples buffered between sample() and drain(), a power of two
+ */
+template <size_t RingSize>
+class CsaCapture {
+public:
+    /**
+     * @brief Raw sample handed from the sampling context
+     */
+    struct Sample {
+        uint32_t time;  // Sample time in microseconds
+        float current;  // As returned by getCurrent()
+    };
+
+    /**
+     * @brief One decimated output bin
+     */
+    struct Bin {
+        uint32_t time;  // Time of the first raw sample in the bin
+        float mean;     // Boxcar average of the raw samples
+        float min;      // Smallest raw sample
+        float max;      // Largest raw sample
+        uint16_t count; // Raw samples in the bin
+    };
+
+    /**
+     * @brief Construct a capture for one channel
+     * @param unit Channel to capture (IChannel)
+     * @param decimation Raw samples per output bin
+     */
+    CsaCapture(uint8_t unit, uint16_t decimation)
+        : channel(unit), factor(decimation ? decimation : 1), previousFrequency(0),
+          readFailures(0), fill(0), sum(0) {}
+
+    /**
+     * @brief Switch the device to 1024 SPS for the capture
+     * @param csa Current sense amplifier to configure
+     * @return true on success
+     */
+    bool start(ICurrentSenseAmplifier &csa) {
+        previousFrequency = csa.getFrequency();
+        fill = 0;
+        return csa.setFrequency(1024);
+    }
+
+    /**
+     * @brief Restore the sample rate in use before start()
+     * @param csa Current sense amplifier to configure
+     * @return true on success
+     */
+    bool stop(ICurrentSenseAmplifier &csa) {
+        return csa.setFrequency(previousFrequency);
+    }
+
+    /**
+     * @brief Refresh the device, read one raw sample and queue it (sampling context only)
+     * @param csa Current sense amplifier to read
+     * @param timeUs Current time in microseconds
+     * @return true if the sample was queued
+     */
+    bool sample(ICurrentSenseAmplifier &csa, uint32_t timeUs) {
+        csa.update();
+        bool stat = false;
+        Sample s;
+        s.time = timeUs;
+        s.current = csa.getCurrent(channel, false, stat);
+        if (!stat) {
+            readFailures++;
+            return false;
+        }
+        return ring.push(s);
+    }
+
+    /**
+     * @brief Decimate queued samples into completed bins (logging context only)
+     * @param out Caller-owned array receiving completed bins
+     * @param maxBins Capacity of out
+     * @return Number of bins written to out
+     */
+    size_t drain(Bin *out, size_t maxBins) {
+        size_t produced = 0;
+        Sample s;
+        while (produced < maxBins && ring.pop(s)) {
+            if (fill == 0) {
+                pending.time = s.time;
+                pending.min = s.current;
+                pending.max = s.current;
+                sum = 0;
+            } else {
+                if (s.current < pending.min) pending.min = s.current;
+                if (s.current > pending.max) pending.max = s.current;
+            }
+            sum += s.current;
+            if (++fill == factor) {
+                pending.mean = sum / fill;
+                pending.count = fill;
+                out[produced++] = pending;
+                fill = 0;
+            }
+        }
+        return produced;
+    }
+
+    /**
+     * @brief Raw samples dropped because drain() did not keep up
+     * @return Overflow count
+     */
+    uint32_t getOverflows() const { return ring.getOverflows(); }
+
+    /**
+     * @brief Raw samples lost to failed getCurrent() reads
+     * @return Failure count
+     */
+    uint32_t getReadFailures() const { return readFailures; }
+
+private:
+    SampleRing<Sample, RingSize> ring;
+    uint8_t channel;
+    uint16_t factor;
+    uint16_t previousFrequency;
+    volatile uint32_t readFailures; // Written only by the sampling context
+    uint16_t fill;                  // Raw samples in the pending bin
+    float sum;                      // Running sum of the pending bin
+    Bin pending;
+};
+
+#endif // CSA_CAPTURE_H
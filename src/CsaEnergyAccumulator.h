@@ -0,0 +1,172 @@
+/**
+ * @file CsaEnergyAccumulator.h
+ * @brief Per-rail energy and charge totals from a current sense amplifier
+ *
+ * Maintains 64-bit running energy and charge totals for each CSA channel
+ * over days of operation. Each poll() refreshes the device once with
+ * update(true) and, where the device exposes its hardware power
+ * accumulator, uses the average power over every sample since the
+ * previous poll rather than a single averaged snapshot. Accumulator and
+ * sample count rollovers reported by testOverflow() are reconstructed
+ * from the expected magnitude.
+ *
+ * Charge is an estimate. With an accumulator it is the accumulated
+ * energy divided by the device's averaged bus voltage at poll time, which
+ * is a short rolling average, not an average over the poll interval, so
+ * it assumes the bus voltage stays nearly constant between polls (units:
+ * getPowerAvg() / getBusVoltage() = getCurrent(), e.g. W/V = A). Without
+ * an accumulator it is the averaged current reading times the interval.
+ *
+ * Totals are kept in micro-units of the driver's getPowerAvg() and
+ * getCurrent() units times seconds; getEnergy() and getCharge() convert to
+ * unit-hours (e.g. W -> Wh, A -> Ah).
+ *
+ * © 2025 Regents of the University of Minnesota. All rights reserved.
+ */
+
+#ifndef CSA_ENERGY_ACCUMULATOR_H
+#define CSA_ENERGY_ACCUMULATOR_H
+
+#include <stdint.h>
+#include <math.h>
+#include "ICurrentSenseAmplifier.h"
+
+/**
+ * @brief Energy and charge accumulator for all CSA channels
+ */
+class CsaEnergyAccumulator {
+public:
+    /**
+     * @brief Construct an accumulator
+     * @param channelMask Bit (1 << IChannel) set for each channel to accumulate
+     * @param accumulatorBits Width of the device's power accumulator register
+     * @param countBits Width of the device's accumulator sample count register
+     */
+    explicit CsaEnergyAccumulator(uint8_t channelMask = 0x0F, uint8_t accumulatorBits = 48, uint8_t countBits = 24)
+        : mask(channelMask), accWrap((double)(1ULL << accumulatorBits)), countWrap((double)(1ULL << countBits)),
+          started(false), lastMs(0), rollovers(0) {
+        reset();
+    }
+
+    /**
+     * @brief Clear all totals; the next poll() only establishes a baseline
+     */
+    void reset() {
+        for (uint8_t i = 0; i < CSA_NUM_CHANNELS; i++) {
+            energy[i] = 0;
+            charge[i] = 0;
+        }
+        started = false;
+        rollovers = 0;
+    }
+
+    /**
+     * @brief Refresh the device and add the interval since the previous poll
+     * @param csa Current sense amplifier to poll
+     * @param nowMs Current time in milliseconds (e.g. millis())
+     * @return true if the interval was accumulated, false on the baseline poll
+     */
+    bool poll(ICurrentSenseAmplifier &csa, uint32_t nowMs) {
+        csa.update(true);
+        const bool overflow = csa.testOverflow();
+        if (!started) {
+            started = true;
+            lastMs = nowMs;
+            return false;
+        }
+        const uint32_t dtMs = nowMs - lastMs;
+        lastMs = nowMs;
+        const float lsb = csa.getAccumulatorLsb();
+        if (overflow) rollovers++;
+
+        for (uint8_t unit = 0; unit < CSA_NUM_CHANNELS; unit++) {
+            if (!(mask & (1 << unit))) continue;
+            bool stat = false;
+            double power = csa.getPowerAvg(unit, stat);
+            bool accumulated = false;
+            int64_t acc = 0;
+            uint32_t count = 0;
+            if (stat && lsb > 0 && csa.getAccumulator(unit, acc, count)) {
+                double samples = count;
+                double sum = (double)acc;
+                if (overflow) {
+                    // Pick the number of wraps that brings the registers closest to
+                    // what the elapsed time and the averaged power predict
+                    const double expectedSamples = dtMs / 1000.0 * csa.getFrequency();
+                    samples += countWrap * llround((expectedSamples - samples) / countWrap);
+                    sum += accWrap * llround((power / lsb * samples - sum) / accWrap);
+                }
+                if (samples > 0) {
+                    power = sum * lsb / samples;
+                    accumulated = true;
+                }
+            }
+            if (stat) energy[unit] += llround(power * dtMs * 1000.0);
+
+            if (accumulated) {
+                // Estimate assumes a near-constant bus voltage over the poll interval
+                bool voltageStat = false;
+                const float voltage = csa.getBusVoltage(unit, true, voltageStat);
+                if (voltageStat && voltage > 0) {
+                    charge[unit] += llround(power / voltage * dtMs * 1000.0);
+                    continue;
+                }
+            }
+            const float current = csa.getCurrent(unit, true, stat);
+            if (stat) charge[unit] += llround((double)current * dtMs * 1000.0);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Energy accumulated on a channel
+     * @param unit Channel
+     * @return Energy in getPowerAvg() units times hours
+     */
+    double getEnergy(uint8_t unit) const {
+        return (unit < CSA_NUM_CHANNELS) ? energy[unit] / MICRO_PER_HOUR : 0;
+    }
+
+    /**
+     * @brief Charge accumulated on a channel
+     * @param unit Channel
+     * @return Charge in getCurrent() units times hours
+     */
+    double getCharge(uint8_t unit) const {
+        return (unit < CSA_NUM_CHANNELS) ? charge[unit] / MICRO_PER_HOUR : 0;
+    }
+
+    /**
+     * @brief Raw running energy total
+     * @param unit Channel
+     * @return Energy in micro-units of getPowerAvg() times seconds
+     */
+    int64_t getRawEnergy(uint8_t unit) const { return (unit < CSA_NUM_CHANNELS) ? energy[unit] : 0; }
+
+    /**
+     * @brief Raw running charge total
+     * @param unit Channel
+     * @return Charge in micro-units of getCurrent() times seconds
+     */
+    int64_t getRawCharge(uint8_t unit) const { return (unit < CSA_NUM_CHANNELS) ? charge[unit] : 0; }
+
+    /**
+     * @brief Number of polls where testOverflow() reported a rollover
+     * @return Rollover count since the last reset()
+     */
+    uint32_t getRollovers() const { return rollovers; }
+
+private:
+    static constexpr double MICRO_PER_HOUR = 3.6e9;
+
+    uint8_t mask;
+    double accWrap;   // 2^accumulatorBits
+    double countWrap; // 2^countBits
+    bool started;
+    uint32_t lastMs;
+    uint32_t rollovers;
+    int64_t energy[CSA_NUM_CHANNELS];
+    int64_t charge[CSA_NUM_CHANNELS];
+};
+
+#endif // CSA_ENERGY_ACCUMULATOR_H
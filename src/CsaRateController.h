@@ -0,0 +1,137 @@
+/**
+ * @file CsaRateController.h
+ * @brief Adaptive sample-rate control for current sense amplifiers
+ *
+ * Watches the variability of a CSA channel's current and moves the device
+ * between the IFrequency sample rates: up as soon as the current becomes
+ * busy, back down only after several quiet windows in a row. Quiet
+ * periods therefore run at 8 SPS and the amplifier itself draws less,
+ * while transients still get the higher rates. Time spent at each rate is
+ * reported so the policy can be evaluated in the field.
+ *
+ * © 2025 Regents of the University of Minnesota. All rights reserved.
+ */
+
+#ifndef CSA_RATE_CONTROLLER_H
+#define CSA_RATE_CONTROLLER_H
+
+#include <stdint.h>
+#include "ICurrentSenseAmplifier.h"
+#include "RunningStats.h"
+
+/**
+ * @brief Variance-driven sample-rate controller
+ */
+class CsaRateController {
+public:
+    static constexpr uint8_t NUM_RATES = 4;
+
+    /**
+     * @brief Construct a controller
+     * @param unit Channel whose current drives the decision (IChannel)
+     * @param upThreshold Current standard deviation at or above which the rate steps up
+     * @param downThreshold Current standard deviation below which a window counts as quiet
+     * @param window Readings per decision window
+     * @param holdWindows Consecutive quiet windows required before stepping down
+     */
+    CsaRateController(uint8_t unit, float upThreshold, float downThreshold,
+                      uint16_t window = 32, uint8_t holdWindows = 4)
+        : channel(unit), upLimit(upThreshold), downLimit(downThreshold),
+          windowSize(window ? window : 1), hold(holdWindows), index(0), quiet(0),
+          lastMs(0), changes(0) {
+        for (uint8_t i = 0; i < NUM_RATES; i++) timeAtRate[i] = 0;
+    }
+
+    /**
+     * @brief Put the device at the lowest rate and start timing
+     * @param csa Current sense amplifier to control
+     * @param nowMs Current time in milliseconds
+     * @return true on success
+     */
+    bool begin(ICurrentSenseAmplifier &csa, uint32_t nowMs) {
+        index = 0;
+        quiet = 0;
+        stats.reset();
+        lastMs = nowMs;
+        return csa.setFrequency(rateAt(index));
+    }
+
+    /**
+     * @brief Refresh the device, take one reading and adjust the rate at the end of a window
+     * @param csa Current sense amplifier to control
+     * @param nowMs Current time in milliseconds
+     * @return true if the sample rate was changed
+     */
+    bool update(ICurrentSenseAmplifier &csa, uint32_t nowMs) {
+        timeAtRate[index] += nowMs - lastMs;
+        lastMs = nowMs;
+
+        csa.update(); // Latch a new conversion; no Clear so accumulators are kept
+        bool stat = false;
+        const float current = csa.getCurrent(channel, false, stat);
+        stats.add(current, stat);
+        if (stats.getCount() < windowSize) return false;
+
+        const float deviation = stats.getStddev();
+        stats.reset();
+        uint8_t target = index;
+        if (deviation >= upLimit) {
+            quiet = 0;
+            if (index + 1 < NUM_RATES) target = index + 1;
+        } else if (deviation < downLimit) {
+            if (index > 0 && ++quiet >= hold) {
+                target = index - 1;
+                quiet = 0;
+            }
+        } else {
+            quiet = 0;
+        }
+        if (target == index) return false;
+        if (!csa.setFrequency(rateAt(target))) return false;
+        index = target;
+        changes++;
+        return true;
+    }
+
+    /**
+     * @brief Current sample rate
+     * @return Samples per second
+     */
+    uint16_t getRate() const { return rateAt(index); }
+
+    /**
+     * @brief Time spent at one of the rates
+     * @param rateIndex 0 = 8 SPS, 1 = 64 SPS, 2 = 256 SPS, 3 = 1024 SPS
+     * @return Milliseconds spent at that rate
+     */
+    uint64_t getTimeAtRate(uint8_t rateIndex) const {
+        return (rateIndex < NUM_RATES) ? timeAtRate[rateIndex] : 0;
+    }
+
+    /**
+     * @brief Number of rate changes made
+     * @return Change count
+     */
+    uint32_t getRateChanges() const { return changes; }
+
+private:
+    // Samples per second for each rate index, in IFrequency order (CSA_SPS_8 .. CSA_SPS_1024)
+    static uint16_t rateAt(uint8_t rateIndex) {
+        static const uint16_t rates[NUM_RATES] = {8, 64, 256, 1024};
+        return rates[rateIndex];
+    }
+
+    RunningStats<> stats;
+    uint8_t channel;
+    float upLimit;
+    float downLimit;
+    uint16_t windowSize;
+    uint8_t hold;
+    uint8_t index;  // Current rate index
+    uint8_t quiet;  // Consecutive quiet windows
+    uint32_t lastMs;
+    uint32_t changes;
+    uint64_t timeAtRate[NUM_RATES];
+};
+
+#endif // CSA_RATE_CONTROLLER_H
@@ -12,12 +12,34 @@
  #define I_ACCELEROMETER_H
  
  #include <stdint.h>
+ #include <stddef.h>
  
  /**
   * @brief Abstract interface for accelerometer sensors
   */
  class IAccelerometer {
  public:
+     /**
+      * @brief Single timestamped acceleration record
+      */
+     struct Sample {
+         uint32_t time; // Capture time in ms (millis()), 0 if not timestamped
+         float x;       // X-axis acceleration in g units
+         float y;       // Y-axis acceleration in g units
+         float z;       // Z-axis acceleration in g units
+     };
+ 
+     /**
+      * @brief Single timestamped acceleration record in raw sensor counts
+      */
+     struct RawSample {
+         uint32_t time; // Capture time in ms (millis()), 0 if not timestamped
+         int16_t x;     // X-axis acceleration in raw counts
+         int16_t y;     // Y-axis acceleration in raw counts
+         int16_t z;     // Z-axis acceleration in raw counts
+         uint8_t range; // Range setting the sample was captured with
+     };
+ 
      virtual ~IAccelerometer() = default;
  
      /**
@@ -65,6 +87,85 @@
       * @param offsetZ Z-axis offset value
       */
      virtual void setOffset(float offsetX, float offsetY, float offsetZ) = 0;
+ 
+     /**
+      * @brief Drain buffered samples from the sensor in a single burst
+      *
+      * Implementations with a hardware FIFO should override this to read all
+      * pending samples in one bus transaction. The default implementation
+      * falls back to a single updateAccelAll() and returns one sample.
+      *
+      * @param buffer Caller-owned array to receive the samples, oldest first
+      * @param maxCount Capacity of buffer in samples
+      * @return Number of samples written to buffer (0 if none or on failure)
+      */
+     virtual size_t readSamples(Sample* buffer, size_t maxCount) {
+         if (buffer == nullptr || maxCount == 0) return 0;
+         if (updateAccelAll() != 0) return 0;
+         const float* data = getData();
+         buffer[0].time = 0;
+         buffer[0].x = data[0];
+         buffer[0].y = data[1];
+         buffer[0].z = data[2];
+         return 1;
+     }
+ 
+     /**
+      * @brief Drain buffered samples from the sensor as raw counts
+      *
+      * Skips the per-sample scale and offset conversion so raw data can be
+      * archived directly; use getScale() or convertRawSamples() to obtain
+      * g units later. The default implementation does not support raw reads.
+      *
+      * @param buffer Caller-owned array to receive the samples, oldest first
+      * @param maxCount Capacity of buffer in samples
+      * @return Number of samples written to buffer (0 if none, on failure or unsupported)
+      */
+     virtual size_t readRawSamples(RawSample* buffer, size_t maxCount) {
+         (void)buffer;
+         (void)maxCount;
+         return 0;
+     }
+ 
+     /**
+      * @brief Get the conversion factor from raw counts to g units
+      * @param range Sensitivity range setting
+      * @return g per count for the range, 0 if raw reads are unsupported
+      */
+     virtual float getScale(uint8_t range) {
+         (void)range;
+         return 0;
+     }
+ 
+     /**
+      * @brief Convert raw samples to offset-corrected g units
+      *
+      * Applies getScale() for each sample's range and subtracts the current
+      * offsets, matching the values readSamples() would have produced.
+      *
+      * @param raw Raw samples to convert
+      * @param out Caller-owned array receiving converted samples (may not alias raw)
+      * @param count Number of samples to convert
+      */
+     void convertRawSamples(const RawSample* raw, Sample* out, size_t count) {
+         if (count == 0) return;
+         const float* offset = getOffset();
+         const float offX = offset[0];
+         const float offY = offset[1];
+         const float offZ = offset[2];
+         uint8_t range = raw[0].range;
+         float scale = getScale(range);
+         for (size_t i = 0; i < count; i++) {
+             if (raw[i].range != range) {
+                 range = raw[i].range;
+                 scale = getScale(range);
+             }
+             out[i].time = raw[i].time;
+             out[i].x = raw[i].x * scale - offX;
+             out[i].y = raw[i].y * scale - offY;
+             out[i].z = raw[i].z * scale - offZ;
+         }
+     }
  };
  
  #endif // I_ACCELEROMETER_H
\ No newline at end of file
@@ -29,6 +29,19 @@
          IR = 4
      };
  
+     static constexpr uint8_t NUM_CHANNELS = 5;
+ 
+     /**
+      * @brief Calibrated values of every channel from one coherent read
+      */
+     struct ChannelReadings {
+         float values[NUM_CHANNELS]; // Indexed by Channel
+         uint8_t validMask;          // Bit (1 << Channel) set if that value is valid
+ 
+         float get(Channel channel) const { return values[static_cast<uint8_t>(channel)]; }
+         bool isValid(Channel channel) const { return validMask & (1 << static_cast<uint8_t>(channel)); }
+     };
+ 
      virtual ~IAmbientLight() = default;
  
      /**
@@ -63,6 +76,86 @@
       * @return 0 on success, error code on failure
       */
      virtual int autoRange() = 0;
+ 
+     /**
+      * @brief Get the number of conversions spent by the last autoRange() call
+      * @return Conversion count, 0 if the implementation does not track it
+      */
+     virtual uint8_t getAutoRangeConversions() { return 0; }
+ 
+     /**
+      * @brief Start a conversion without waiting for it to finish
+      *
+      * Split-phase alternative to getLux(): call startConversion(), schedule
+      * other work until getConversionTime() has elapsed or
+      * isConversionReady() returns true, then call collectLux(). The
+      * default implementations do all the work in collectLux(), so callers
+      * behave correctly (though blocking) on drivers that do not override them.
+      *
+      * @return 0 on success, error code on failure
+      */
+     virtual int startConversion() { return 0; }
+ 
+     /**
+      * @brief Get the time a conversion takes at the current settings
+      * @return Milliseconds from startConversion() until the result is due (completion deadline)
+      */
+     virtual uint32_t getConversionTime() { return 0; }
+ 
+     /**
+      * @brief Check whether the conversion started by startConversion() has completed
+      * @return true if collectLux() will not block
+      */
+     virtual bool isConversionReady() { return true; }
+ 
+     /**
+      * @brief Collect the result of the conversion started by startConversion()
+      * @param lux Set to the light level in lux on success
+      * @return 0 on success, error code on failure or if no result is ready
+      */
+     virtual int collectLux(float &lux) {
+         lux = getLux();
+         return 0;
+     }
+ 
+     /**
+      * @brief Get the light level from two back-to-back readings at different gains
+      *
+      * Implementations should take a high- and a low-gain reading and merge
+      * them (see LightHdrMerge) so a valid value is returned even when one
+      * gain saturates or underflows. The default implementation returns a
+      * single getLux() reading and never reports saturation.
+      *
+      * @param lux Set to the merged light level in lux
+      * @param saturated Set to true if both readings saturated and lux is a lower bound
+      * @return 0 on success, error code on failure
+      */
+     virtual int getLuxHdr(float &lux, bool &saturated) {
+         lux = getLux();
+         saturated = false;
+         return 0;
+     }
+ 
+     /**
+      * @brief Read all channels at once
+      *
+      * Implementations should override this to fetch every channel in a
+      * single auto-increment burst so the values come from the same
+      * conversion. The default implementation falls back to one
+      * getValue() call per channel.
+      *
+      * @param readings Populated with the calibrated value of each channel
+      * @return 0 if every channel is valid, error code otherwise
+      */
+     virtual int readAllChannels(ChannelReadings &readings) {
+         readings.validMask = 0;
+         for (uint8_t i = 0; i < NUM_CHANNELS; i++) {
+             bool error = false;
+             readings.values[i] = getValue(static_cast<Channel>(i), error);
+             if (!error) readings.validMask |= (1 << i);
+         }
+         return (readings.validMask == (1 << NUM_CHANNELS) - 1) ? 0 : -1;
+     }
  };
  
  #endif // I_AMBIENT_LIGHT_H
\ No newline at end of file
@@ -5,6 +5,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "Result.h"
 
 enum IChannel {
     CSA_CH1 = 0,
@@ -23,6 +24,33 @@ enum IFrequency {
 #define CSA_BIDIRECTIONAL 1
 #define CSA_UNIDIRECTIONAL 0
 
+#define CSA_NUM_CHANNELS 4
+
+// Per-field status bits in CsaChannelSnapshot::status
+#define CSA_STAT_BUS_VOLTAGE   0x01
+#define CSA_STAT_SENSE_VOLTAGE 0x02
+#define CSA_STAT_CURRENT       0x04
+#define CSA_STAT_POWER         0x08
+
+/**
+ * @brief Values of one channel taken from the same conversion
+ */
+struct CsaChannelSnapshot {
+    float busVoltage;   // As returned by getBusVoltage()
+    float senseVoltage; // As returned by getSenseVoltage()
+    float current;      // As returned by getCurrent()
+    float power;        // As returned by getPowerAvg()
+    uint8_t status;     // CSA_STAT_* bits set for each field that read successfully
+};
+
+/**
+ * @brief Coherent snapshot of all channels after a single refresh
+ */
+struct CsaSnapshot {
+    CsaChannelSnapshot channel[CSA_NUM_CHANNELS]; // Indexed by IChannel
+    uint8_t updateStatus;                         // Return value of the update() that triggered the snapshot
+};
+
 /**
  * @brief Abstract interface for current sensing amplifiers
  * 
@@ -56,9 +84,121 @@ public:
     virtual float getPowerAvg(uint8_t Unit, bool& Stat) = 0;
     virtual float getPowerAvg(uint8_t Unit) = 0;
 
+    /**
+     * @brief Read a channel's bus voltage with its status
+     *
+     * The read*() methods return the value and error code together so the
+     * status cannot be dropped. The defaults wrap the bool &Stat overloads;
+     * drivers may override them to report more specific errors.
+     *
+     * @param Unit Channel to read
+     * @param Avg Read the averaged rather than the instantaneous value
+     * @return Bus voltage, RESULT_INVALID_CHANNEL or RESULT_READ_FAILED
+     */
+    virtual Result<float> readBusVoltage(uint8_t Unit, bool Avg = false) {
+        if (Unit >= CSA_NUM_CHANNELS) return Result<float>::failure(RESULT_INVALID_CHANNEL);
+        bool stat = false;
+        const float value = getBusVoltage(Unit, Avg, stat);
+        return stat ? Result<float>::success(value) : Result<float>::failure(RESULT_READ_FAILED, value);
+    }
+
+    /**
+     * @brief Read a channel's sense voltage with its status
+     * @param Unit Channel to read
+     * @param Avg Read the averaged rather than the instantaneous value
+     * @return Sense voltage, RESULT_INVALID_CHANNEL or RESULT_READ_FAILED
+     */
+    virtual Result<float> readSenseVoltage(uint8_t Unit, bool Avg = false) {
+        if (Unit >= CSA_NUM_CHANNELS) return Result<float>::failure(RESULT_INVALID_CHANNEL);
+        bool stat = false;
+        const float value = getSenseVoltage(Unit, Avg, stat);
+        return stat ? Result<float>::success(value) : Result<float>::failure(RESULT_READ_FAILED, value);
+    }
+
+    /**
+     * @brief Read a channel's current with its status
+     * @param Unit Channel to read
+     * @param Avg Read the averaged rather than the instantaneous value
+     * @return Current, RESULT_INVALID_CHANNEL or RESULT_READ_FAILED
+     */
+    virtual Result<float> readCurrent(uint8_t Unit, bool Avg = false) {
+        if (Unit >= CSA_NUM_CHANNELS) return Result<float>::failure(RESULT_INVALID_CHANNEL);
+        bool stat = false;
+        const float value = getCurrent(Unit, Avg, stat);
+        return stat ? Result<float>::success(value) : Result<float>::failure(RESULT_READ_FAILED, value);
+    }
+
+    /**
+     * @brief Read a channel's average power with its status
+     * @param Unit Channel to read
+     * @return Average power, RESULT_INVALID_CHANNEL or RESULT_READ_FAILED
+     */
+    virtual Result<float> readPowerAvg(uint8_t Unit) {
+        if (Unit >= CSA_NUM_CHANNELS) return Result<float>::failure(RESULT_INVALID_CHANNEL);
+        bool stat = false;
+        const float value = getPowerAvg(Unit, stat);
+        return stat ? Result<float>::success(value) : Result<float>::failure(RESULT_READ_FAILED, value);
+    }
+
     // Status and control
     virtual uint8_t update(uint8_t Clear = false) = 0;
     virtual bool testOverflow() = 0;
+
+    /**
+     * @brief Read a channel's hardware power accumulator
+     *
+     * Values are those latched by the most recent update(true), i.e. the
+     * sum of every power sample since the refresh before it.
+     *
+     * @param Unit Channel to read
+     * @param Accumulator Set to the raw accumulator value (sign-extended in bidirectional mode)
+     * @param Count Set to the number of samples summed into the accumulator
+     * @return true on success, false on failure or if the device has no accumulator
+     */
+    virtual bool getAccumulator(uint8_t Unit, int64_t &Accumulator, uint32_t &Count) {
+        (void)Unit;
+        Accumulator = 0;
+        Count = 0;
+        return false;
+    }
+
+    /**
+     * @brief Get the power represented by one accumulator LSB
+     * @return Power per LSB in the units of getPowerAvg(), 0 if there is no accumulator
+     */
+    virtual float getAccumulatorLsb() { return 0; }
+
+    /**
+     * @brief Refresh once and read every channel's values into one struct
+     *
+     * Implementations should override this to trigger a single update()
+     * and fetch all result registers in one block read, so every value
+     * comes from the same conversion. The default implementation calls
+     * update() once and then the per-channel getters.
+     *
+     * @param snapshot Populated with bus voltage, sense voltage, current and power per channel
+     * @param Avg Read averaged rather than instantaneous values
+     * @return true if every field of every channel read successfully
+     */
+    virtual bool getSnapshot(CsaSnapshot &snapshot, bool Avg = false) {
+        snapshot.updateStatus = update();
+        bool ok = true;
+        for (uint8_t unit = 0; unit < CSA_NUM_CHANNELS; unit++) {
+            CsaChannelSnapshot &ch = snapshot.channel[unit];
+            bool stat = false;
+            ch.status = 0;
+            ch.busVoltage = getBusVoltage(unit, Avg, stat);
+            if (stat) ch.status |= CSA_STAT_BUS_VOLTAGE;
+            ch.senseVoltage = getSenseVoltage(unit, Avg, stat);
+            if (stat) ch.status |= CSA_STAT_SENSE_VOLTAGE;
+            ch.current = getCurrent(unit, Avg, stat);
+            if (stat) ch.status |= CSA_STAT_CURRENT;
+            ch.power = getPowerAvg(unit, stat);
+            if (stat) ch.status |= CSA_STAT_POWER;
+            if (ch.status != (CSA_STAT_BUS_VOLTAGE | CSA_STAT_SENSE_VOLTAGE | CSA_STAT_CURRENT | CSA_STAT_POWER)) ok = false;
+        }
+        return ok;
+    }
 };
 
 #endif // ICURRENT_SENSE_AMPLIFIER_H
\ No newline at end of file
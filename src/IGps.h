@@ -49,7 +49,7 @@ struct IUbxPacket
   uint16_t len;          // Length of the payload. Does not include cls, id, or checksum bytes
   uint16_t counter;      // Keeps track of number of overall bytes received. Some responses are larger than 255 bytes.
   uint16_t startingSpot; // The counter value needed to go past before we begin recording into payload array
-  uint8_t *payload;      // We will allocate RAM for the payload if/when needed.
+  uint8_t *payload;      // MAX_PAYLOAD_SIZE buffer, e.g. from UbxPayloadPool, set when needed
   uint8_t checksumA;     // Given to us from module. Checked against the rolling calculated A/B checksums.
   uint8_t checksumB;
   Isfe_ublox_packet_validity_e valid;           // Goes from NOT_DEFINED to VALID or NOT_VALID when checksum is checked
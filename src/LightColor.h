@@ -0,0 +1,126 @@
+/**
+ * @file LightColor.h
+ * @brief Chromaticity and correlated color temperature from RGB light channels
+ *
+ * Converts the Red/Green/Blue channel readings of an IAmbientLight sensor
+ * to CIE 1931 XYZ with a 3x3 matrix, then to xy chromaticity and
+ * correlated color temperature (CCT) using McCamy's cubic approximation
+ * evaluated in Horner form, so no pow() or other transcendental calls are
+ * needed. The Clear channel gates out readings too dark to be meaningful.
+ *
+ * © 2025 Regents of the University of Minnesota. All rights reserved.
+ */
+
+#ifndef LIGHT_COLOR_H
+#define LIGHT_COLOR_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "IAmbientLight.h"
+
+/**
+ * @brief Row-major 3x3 matrix mapping [R, G, B] to [X, Y, Z]
+ */
+struct ColorMatrix {
+    float m[9];
+};
+
+/**
+ * @brief Linear sRGB (D65) to XYZ; replace with a sensor calibration when available
+ */
+constexpr ColorMatrix RGB_TO_XYZ_SRGB = {{
+    0.4124f, 0.3576f, 0.1805f,
+    0.2126f, 0.7152f, 0.0722f,
+    0.0193f, 0.1192f, 0.9505f
+}};
+
+/**
+ * @brief Chromaticity derived from one reading
+ */
+struct Chromaticity {
+    float x;    // CIE 1931 x
+    float y;    // CIE 1931 y
+    float cct;  // Correlated color temperature in kelvin
+    bool valid; // false if the reading was too dark or invalid
+};
+
+/**
+ * @brief Converter from RGB channel readings to chromaticity and CCT
+ */
+class LightColor {
+public:
+    /**
+     * @brief Construct a converter
+     * @param rgbToXyz Sensor RGB to XYZ matrix
+     * @param minClear Smallest Clear channel value accepted as a valid reading
+     */
+    explicit LightColor(const ColorMatrix& rgbToXyz = RGB_TO_XYZ_SRGB, float minClear = 1.0f)
+        : matrix(rgbToXyz), threshold(minClear) {}
+
+    /**
+     * @brief Compute chromaticity for one reading
+     * @param red Red channel value
+     * @param green Green channel value
+     * @param blue Blue channel value
+     * @param clear Clear channel value
+     * @return Chromaticity, valid is false if clear is below the threshold
+     */
+    Chromaticity compute(float red, float green, float blue, float clear) const {
+        Chromaticity out;
+        const float* m = matrix.m;
+        const float X = m[0] * red + m[1] * green + m[2] * blue;
+        const float Y = m[3] * red + m[4] * green + m[5] * blue;
+        const float Z = m[6] * red + m[7] * green + m[8] * blue;
+        const float sum = X + Y + Z;
+        out.valid = (clear >= threshold) && (sum > 0);
+        if (!out.valid) {
+            out.x = 0;
+            out.y = 0;
+            out.cct = 0;
+            return out;
+        }
+        const float inv = 1.0f / sum;
+        out.x = X * inv;
+        out.y = Y * inv;
+
+        // McCamy (1992): n = (x - xe) / (ye - y), CCT = 449 n^3 + 3525 n^2 + 6823.3 n + 5520.33
+        const float n = (out.x - 0.3320f) / (0.1858f - out.y);
+        out.cct = ((449.0f * n + 3525.0f) * n + 6823.3f) * n + 5520.33f;
+        return out;
+    }
+
+    /**
+     * @brief Compute chromaticity for a full channel read
+     * @param readings Readings from IAmbientLight::readAllChannels()
+     * @return Chromaticity, valid is false if any needed channel is invalid or too dark
+     */
+    Chromaticity compute(const IAmbientLight::ChannelReadings& readings) const {
+        typedef IAmbientLight::Channel Channel;
+        const uint8_t needed = (1 << static_cast<uint8_t>(Channel::Clear)) |
+                               (1 << static_cast<uint8_t>(Channel::Red)) |
+                               (1 << static_cast<uint8_t>(Channel::Green)) |
+                               (1 << static_cast<uint8_t>(Channel::Blue));
+        Chromaticity out = compute(readings.get(Channel::Red), readings.get(Channel::Green),
+                                   readings.get(Channel::Blue), readings.get(Channel::Clear));
+        if ((readings.validMask & needed) != needed) out.valid = false;
+        return out;
+    }
+
+    /**
+     * @brief Compute chromaticity for an array of readings
+     * @param readings Readings to convert
+     * @param out Caller-owned array receiving one result per reading
+     * @param count Number of readings
+     */
+    void computeBatch(const IAmbientLight::ChannelReadings* readings, Chromaticity* out, size_t count) const {
+        for (size_t i = 0; i < count; i++) {
+            out[i] = compute(readings[i]);
+        }
+    }
+
+private:
+    ColorMatrix matrix;
+    float threshold;
+};
+
+#endif // LIGHT_COLOR_H
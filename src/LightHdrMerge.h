@@ -0,0 +1,92 @@
+/**
+ * @file LightHdrMerge.h
+ * @brief Dual-gain HDR merge for ambient light readings
+ *
+ * Combines two back-to-back raw readings taken at a high and a low gain
+ * (or integration time) into one linearized value. The high-gain reading
+ * is used while it has headroom, the low-gain reading once the high one
+ * saturates, and the two are cross-faded in between so there is no step
+ * at the hand-over. A valid value is produced every interval without
+ * re-running autoRange(); the saturated flag is only set when even the
+ * low-gain reading clipped.
+ *
+ * Intended for use inside IAmbientLight::getLuxHdr() implementations.
+ *
+ * © 2025 Regents of the University of Minnesota. All rights reserved.
+ */
+
+#ifndef LIGHT_HDR_MERGE_H
+#define LIGHT_HDR_MERGE_H
+
+#include <stdint.h>
+
+/**
+ * @brief Result of an HDR merge
+ */
+struct LightHdrReading {
+    float value;    // Linearized light level (raw count / sensitivity)
+    bool saturated; // true if the low-gain reading also clipped, value is a lower bound
+    bool underflow; // true if the high-gain reading was zero, value is an upper bound
+};
+
+/**
+ * @brief Merges a high-gain and a low-gain reading
+ */
+class LightHdrMerge {
+public:
+    /**
+     * @brief Construct a merger for a pair of settings
+     * @param maxCount Full-scale raw count of the sensor
+     * @param highSensitivity Counts per unit light at the high gain setting
+     * @param lowSensitivity Counts per unit light at the low gain setting
+     */
+    LightHdrMerge(uint16_t maxCount, float highSensitivity, float lowSensitivity)
+        : invHigh(1.0f / highSensitivity), invLow(1.0f / lowSensitivity),
+          blendStart(0.7f * maxCount), saturation(0.95f * maxCount) {}
+
+    /**
+     * @brief Set the count range over which the two readings are cross-faded
+     * @param startCount High-gain count where blending toward the low-gain reading begins
+     * @param saturationCount Count at or above which a reading is treated as clipped
+     */
+    void setBlendRange(float startCount, float saturationCount) {
+        blendStart = startCount;
+        saturation = saturationCount;
+    }
+
+    /**
+     * @brief Merge one pair of readings
+     * @param highCount Raw count at the high gain setting
+     * @param lowCount Raw count at the low gain setting
+     * @return Merged, linearized reading
+     */
+    LightHdrReading merge(uint16_t highCount, uint16_t lowCount) const {
+        LightHdrReading out;
+        out.saturated = false;
+        out.underflow = false;
+        const float high = highCount * invHigh;
+        const float low = lowCount * invLow;
+
+        if (highCount == 0) {
+            out.value = 0;
+            out.underflow = true;
+        } else if (highCount <= blendStart) {
+            out.value = high;
+        } else if (highCount < saturation) {
+            const float w = (highCount - blendStart) / (saturation - blendStart);
+            out.value = high + w * (low - high);
+        } else {
+            out.value = low;
+            out.saturated = (lowCount >= saturation);
+        }
+        return out;
+    }
+
+private:
+    float invHigh;
+    float invLow;
+    float blendStart;
+    float saturation;
+};
+
+#endif // LIGHT_HDR_MERGE_H
@@ -0,0 +1,239 @@
+/**
+ * @file LightIntegrator.h
+ * @brief Daily light integral and hourly PAR accumulator
+ *
+ * Integrates timestamped light readings (getLux() or a calibrated channel)
+ * with the trapezoidal rule into running hourly PAR totals and a daily
+ * light integral (DLI). Readings may be irregularly spaced; intervals
+ * that straddle an hour or day boundary are split there, and intervals
+ * longer than a maximum gap are not integrated but reported as missing
+ * coverage; the periods in progress are closed once and restarted at the
+ * reading after the gap. Each reading costs O(1) (at most one step per
+ * hour of maxGapSeconds); only a handful of numbers need to be logged per
+ * day. Completed periods are queued until takeHour()/takeDay() consumes
+ * them.
+ *
+ * © 2025 Regents of the University of Minnesota. All rights reserved.
+ */
+
+#ifndef LIGHT_INTEGRATOR_H
+#define LIGHT_INTEGRATOR_H
+
+#include <stdint.h>
+
+/**
+ * @brief Incremental trapezoidal light integrator
+ */
+class LightIntegrator {
+public:
+    /**
+     * @brief Total for a completed hour or day
+     */
+    struct Period {
+        int64_t start;    // Unix time the period began
+        double total;     // Integrated PAR in mol/m^2 (DLI for a day)
+        uint32_t covered; // Seconds of the period that were integrated
+    };
+
+    /**
+     * @brief Construct an integrator
+     * @param luxToPpfd Conversion from reading to PPFD in umol/m^2/s (about 0.0185 for sunlight lux)
+     * @param maxGapSeconds Longest interval between readings that is still integrated
+     * @param utcOffsetSeconds Local time offset used for hour and day boundaries
+     */
+    explicit LightIntegrator(float luxToPpfd = 0.0185f, uint32_t maxGapSeconds = 900,
+                             int32_t utcOffsetSeconds = 0)
+        : factor(luxToPpfd), maxGap(maxGapSeconds), utcOffset(utcOffsetSeconds) {
+        hours.dropped = 0;
+        days.dropped = 0;
+        reset();
+    }
+
+    /**
+     * @brief Discard all readings and totals
+     */
+    void reset() {
+        hasPrevious = false;
+        hours.clear();
+        days.clear();
+        hour.total = 0;
+        hour.covered = 0;
+        day.total = 0;
+        day.covered = 0;
+        gapSeconds = 0;
+    }
+
+    /**
+     * @brief Add one reading
+     *
+     * Readings must be in time order; a reading at or before the previous
+     * one is ignored.
+     *
+     * @param unixTime Time of the reading in seconds (e.g. IRtc::getTimeUnix())
+     * @param value Light reading in the units luxToPpfd expects
+     */
+    void add(int64_t unixTime, float value) {
+        const double ppfd = value * factor;
+        if (!hasPrevious) {
+            hasPrevious = true;
+            startPeriods(unixTime);
+            previousTime = unixTime;
+            previousPpfd = ppfd;
+            return;
+        }
+        if (unixTime <= previousTime) return;
+
+        if (unixTime - previousTime > (int64_t)maxGap) {
+            // Nothing to integrate: close the periods in progress once and restart after the gap
+            const int64_t missing = unixTime - previousTime;
+            gapSeconds = (missing > (int64_t)(UINT32_MAX - gapSeconds)) ? UINT32_MAX : gapSeconds + (uint32_t)missing;
+            if (unixTime >= hourEnd) closeHour();
+            if (unixTime >= dayEnd) closeDay();
+            startPeriods(unixTime);
+            previousTime = unixTime;
+            previousPpfd = ppfd;
+            return;
+        }
+
+        int64_t t0 = previousTime;
+        double v0 = previousPpfd;
+        while (t0 < unixTime) {
+            const int64_t boundary = (hourEnd < dayEnd) ? hourEnd : dayEnd;
+            const int64_t t1 = (unixTime < boundary) ? unixTime : boundary;
+            const double v1 = previousPpfd + (ppfd - previousPpfd) * (double)(t1 - previousTime) / (unixTime - previousTime);
+            const uint32_t dt = (uint32_t)(t1 - t0);
+            const double area = 0.5 * (v0 + v1) * dt * 1e-6;
+            hour.total += area;
+            hour.covered += dt;
+            day.total += area;
+            day.covered += dt;
+            t0 = t1;
+            v0 = v1;
+            if (t0 == hourEnd) closeHour();
+            if (t0 == dayEnd) closeDay();
+        }
+        previousTime = unixTime;
+        previousPpfd = ppfd;
+    }
+
+    /**
+     * @brief PAR integrated so far in the current hour
+     * @return mol/m^2
+     */
+    double getHourTotal() const { return hour.total; }
+
+    /**
+     * @brief Daily light integral so far in the current day
+     * @return mol/m^2
+     */
+    double getDayTotal() const { return day.total; }
+
+    /**
+     * @brief Consume the oldest completed hour
+     * @param completed Set to the completed hour's total when one is available
+     * @return true if a completed hour was waiting
+     */
+    bool takeHour(Period &completed) { return hours.pop(completed); }
+
+    /**
+     * @brief Consume the oldest completed day
+     * @param completed Set to the completed day's DLI when one is available
+     * @return true if a completed day was waiting
+     */
+    bool takeDay(Period &completed) { return days.pop(completed); }
+
+    /**
+     * @brief Completed periods discarded because they were not taken in time
+     * @return Hours and days dropped (oldest first) since construction
+     */
+    uint32_t getDroppedPeriods() const { return hours.dropped + days.dropped; }
+
+    /**
+     * @brief Total time skipped because readings were too far apart
+     * @return Seconds not integrated since the last reset()
+     */
+    uint32_t getGapSeconds() const { return gapSeconds; }
+
+private:
+    static constexpr int64_t HOUR = 3600;
+    static constexpr int64_t DAY = 86400;
+    static constexpr uint8_t PENDING = 4; // Completed periods kept per kind until taken
+
+    // Completed periods waiting for takeHour()/takeDay(); the oldest is dropped when full
+    struct PeriodQueue {
+        Period items[PENDING];
+        uint8_t first;
+        uint8_t count;
+        uint32_t dropped;
+
+        void clear() {
+            first = 0;
+            count = 0;
+        }
+
+        void push(const Period &p) {
+            if (count == PENDING) {
+                first = (first + 1) % PENDING;
+                count--;
+                dropped++;
+            }
+            items[(first + count) % PENDING] = p;
+            count++;
+        }
+
+        bool pop(Period &p) {
+            if (count == 0) return false;
+            p = items[first];
+            first = (first + 1) % PENDING;
+            count--;
+            return true;
+        }
+    };
+
+    // Start of the local period containing t, expressed in Unix time
+    int64_t periodStart(int64_t t, int64_t length) const {
+        const int64_t local = t + utcOffset;
+        int64_t start = local - (local % length);
+        if (local % length < 0) start -= length;
+        return start - utcOffset;
+    }
+
+    void startPeriods(int64_t t) {
+        hour.start = periodStart(t, HOUR);
+        hourEnd = hour.start + HOUR;
+        day.start = periodStart(t, DAY);
+        dayEnd = day.start + DAY;
+    }
+
+    void closeHour() {
+        hours.push(hour);
+        hour.start = hourEnd;
+        hour.total = 0;
+        hour.covered = 0;
+        hourEnd += HOUR;
+    }
+
+    void closeDay() {
+        days.push(day);
+        day.start = dayEnd;
+        day.total = 0;
+        day.covered = 0;
+        dayEnd += DAY;
+    }
+
+    float factor;
+    uint32_t maxGap;
+    int32_t utcOffset;
+    bool hasPrevious;
+    int64_t previousTime;
+    double previousPpfd;
+    Period hour;     // Current hour in progress
+    Period day;      // Current day in progress
+    int64_t hourEnd;
+    int64_t dayEnd;
+    PeriodQueue hours; // Completed hours not yet taken
+    PeriodQueue days;  // Completed days not yet taken
+    uint32_t gapSeconds;
+};
+
+#endif // LIGHT_INTEGRATOR_H
@@ -0,0 +1,151 @@
+/**
+ * @file LightRangePredictor.h
+ * @brief One-step gain/integration time selection for ambient light sensors
+ *
+ * Instead of stepping through gain and integration settings one
+ * measurement at a time, the predictor estimates the light level from a
+ * single reading and the setting it was taken with, then jumps directly
+ * to the most sensitive setting that keeps the predicted count below a
+ * headroom limit. A saturated reading only bounds the light level from
+ * below, so that case takes one extra conversion at the least sensitive
+ * setting before the prediction.
+ *
+ * Intended for use inside IAmbientLight::autoRange() implementations:
+ * @code
+ * uint8_t index = predictor.run([&](uint8_t i) {
+ *     applySetting(table[i]);
+ *     return readRawClear();
+ * });
+ * lastConversions = predictor.getConversions(); // for getAutoRangeConversions()
+ * @endcode
+ *
+ * © 2025 Regents of the University of Minnesota. All rights reserved.
+ */
+
+#ifndef LIGHT_RANGE_PREDICTOR_H
+#define LIGHT_RANGE_PREDICTOR_H
+
+#include <stdint.h>
+
+/**
+ * @brief One gain/integration time combination of a light sensor
+ */
+struct LightRangeSetting {
+    uint8_t gain;            // Driver-specific gain code
+    uint8_t integrationTime; // Driver-specific integration time code
+    float sensitivity;       // Relative counts per unit light (e.g. gain * integration ms)
+};
+
+/**
+ * @brief Predictive range selector
+ */
+class LightRangePredictor {
+public:
+    static constexpr uint8_t MAX_ITERATIONS = 3; // Conversions allowed in one run()
+
+    /**
+     * @brief Construct a predictor for a sensor's setting table
+     * @param settings Available settings in ascending order of sensitivity
+     * @param numSettings Number of entries in settings
+     * @param maxCount Full-scale raw count of the sensor
+     */
+    LightRangePredictor(const LightRangeSetting* settings, uint8_t numSettings, uint16_t maxCount)
+        : table(settings), count(numSettings), fullScale(maxCount),
+          upperFraction(0.8f), saturationFraction(0.95f),
+          lastGood(0), conversions(0) {}
+
+    /**
+     * @brief Set the headroom the predictor leaves below full scale
+     * @param upper Fraction of full scale the predicted count must stay below
+     */
+    void setHeadroom(float upper) { upperFraction = upper; }
+
+    /**
+     * @brief Predict the best setting from one reading
+     * @param rawCount Raw count read at the current setting
+     * @param currentIndex Index of the setting the count was read with
+     * @return Index of the setting to use next (equal to currentIndex if it is already right)
+     */
+    uint8_t predict(uint16_t rawCount, uint8_t currentIndex) const {
+        if (rawCount == 0) return count - 1;
+        if (isSaturated(rawCount)) {
+            // Saturation only bounds the light level from below; drop to the
+            // least sensitive setting so the next reading can be predicted from
+            return (currentIndex > 0) ? 0 : currentIndex;
+        }
+        const float current = table[currentIndex].sensitivity;
+        const float limit = current * upperFraction * fullScale / rawCount;
+
+        // Most sensitive setting whose predicted count stays under the upper bound
+        uint8_t best = 0;
+        for (uint8_t i = 0; i < count; i++) {
+            if (table[i].sensitivity <= limit) best = i;
+        }
+        return best;
+    }
+
+    /**
+     * @brief Check whether a raw count is at or near full scale
+     * @param rawCount Raw count
+     * @return true if the reading is saturated
+     */
+    bool isSaturated(uint16_t rawCount) const {
+        return rawCount >= saturationFraction * fullScale;
+    }
+
+    /**
+     * @brief Run a complete range selection starting from the last good setting
+     *
+     * Measures at the last good setting, jumps to the predicted one and
+     * re-measures until the prediction is stable or MAX_ITERATIONS
+     * conversions have been spent.
+     *
+     * @param measure Callable taking a setting index, applying it and returning the raw count
+     * @return Index of the selected setting
+     */
+    template <typename Measure>
+    uint8_t run(Measure measure) {
+        uint8_t index = lastGood;
+        uint16_t raw = measure(index);
+        conversions = 1;
+        while (conversions < MAX_ITERATIONS) {
+            const uint8_t next = predict(raw, index);
+            if (next == index) break;
+            index = next;
+            raw = measure(index);
+            conversions++;
+        }
+        if (!isSaturated(raw)) lastGood = index;
+        return index;
+    }
+
+    /**
+     * @brief Number of conversions spent by the last run()
+     * @return Conversion count
+     */
+    uint8_t getConversions() const { return conversions; }
+
+    /**
+     * @brief Setting index that last produced an unsaturated reading
+     *
+     * Store this in retained memory before sleeping and pass it back with
+     * setLastGood() after wakeup so the next run() starts close to the
+     * right setting.
+     *
+     * @return Setting index
+     */
+    uint8_t getLastGood() const { return lastGood; }
+
+    void setLastGood(uint8_t index) { lastGood = (index < count) ? index : count - 1; }
+
+private:
+    const LightRangeSetting* table;
+    uint8_t count;
+    uint16_t fullScale;
+    float upperFraction;
+    float saturationFraction;
+    uint8_t lastGood;
+    uint8_t conversions;
+};
+
+#endif // LIGHT_RANGE_PREDICTOR_H
@@ -0,0 +1,246 @@
+/**
+ * @file PowerProfiler.h
+ * @brief Per-phase energy attribution for firmware power profiling
+ *
+ * Firmware marks named phases ("modem", "GPS fix", "SDI-12 poll", ...)
+ * with begin() and end(); the profiler integrates current and bus voltage
+ * samples from a CSA channel and attributes the energy of every interval
+ * to each phase active during it, or to an unattributed baseline when no
+ * phase is active. Phases may overlap or nest.
+ *
+ * Every call takes an explicit timestamp, so the same code runs on the
+ * device (sample() against an ICurrentSenseAmplifier, with millis()) and
+ * in host replay (addSample() fed from a recorded or simulated trace with
+ * the phase markers interleaved at their recorded times).
+ *
+ * Energy is in getCurrent() units times getBusVoltage() units times
+ * seconds (e.g. mA * V * s = mJ); charge is in getCurrent() units times
+ * seconds.
+ *
+ * © 2025 Regents of the University of Minnesota. All rights reserved.
+ */
+
+#ifndef POWER_PROFILER_H
+#define POWER_PROFILER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include "ICurrentSenseAmplifier.h"
+
+/**
+ * @brief Phase-based energy profiler
+ *
+ * @tparam MaxPhases Number of distinct phase names that can be tracked
+ */
+template <uint8_t MaxPhases>
+class PowerProfiler {
+public:
+    static constexpr int NO_PHASE = -1;
+
+    /**
+     * @brief Accumulated totals for one phase
+     */
+    struct Phase {
+        const char *name;  // Name passed to begin(), must outlive the profiler
+        double energy;     // Attributed energy
+        double charge;     // Attributed charge
+        uint32_t activeMs; // Total time the phase was active
+        uint32_t entries;  // Number of begin() calls
+        uint8_t depth;     // Current nesting depth, 0 when inactive
+    };
+
+    /**
+     * @brief Construct a profiler for one CSA channel
+     * @param unit Channel to sample (IChannel)
+     */
+    explicit PowerProfiler(uint8_t unit = CSA_CH1)
+        : channel(unit) {
+        reset();
+    }
+
+    /**
+     * @brief Clear all totals and forget all phases
+     */
+    void reset() {
+        count = 0;
+        activeCount = 0;
+        hasSample = false;
+        hasTime = false;
+        lastMs = 0;
+        lastCurrent = 0;
+        lastVoltage = 0;
+        baselineEnergy = 0;
+        baselineCharge = 0;
+        baselineMs = 0;
+    }
+
+    /**
+     * @brief Mark the start of a phase
+     * @param name Phase name (pointer is stored; use string literals)
+     * @param nowMs Current time in milliseconds
+     * @return Phase id for end(), or NO_PHASE if MaxPhases names are already in use
+     */
+    int begin(const char *name, uint32_t nowMs) {
+        const int id = lookup(name, true);
+        if (id == NO_PHASE) return NO_PHASE;
+        advance(nowMs);
+        Phase &p = phases[id];
+        if (p.depth++ == 0) activeCount++;
+        p.entries++;
+        return id;
+    }
+
+    /**
+     * @brief Mark the end of a phase
+     * @param id Phase id returned by begin()
+     * @param nowMs Current time in milliseconds
+     */
+    void end(int id, uint32_t nowMs) {
+        if (id < 0 || id >= count || phases[id].depth == 0) return;
+        advance(nowMs);
+        if (--phases[id].depth == 0) activeCount--;
+    }
+
+    /**
+     * @brief Mark the end of a phase by name
+     * @param name Phase name passed to begin()
+     * @param nowMs Current time in milliseconds
+     */
+    void end(const char *name, uint32_t nowMs) {
+        end(lookup(name, false), nowMs);
+    }
+
+    /**
+     * @brief Refresh the CSA, read it and add the sample
+     * @param csa Current sense amplifier to read
+     * @param nowMs Current time in milliseconds
+     * @return true if the reads succeeded and the sample was added
+     */
+    bool sample(ICurrentSenseAmplifier &csa, uint32_t nowMs) {
+        csa.update(); // Latch a new conversion; no Clear so accumulators are kept
+        bool currentOk = false;
+        bool voltageOk = false;
+        const float current = csa.getCurrent(channel, false, currentOk);
+        const float voltage = csa.getBusVoltage(channel, false, voltageOk);
+        if (!currentOk || !voltageOk) return false;
+        addSample(nowMs, current, voltage);
+        return true;
+    }
+
+    /**
+     * @brief Add one sample (device path via sample(), or host replay)
+     *
+     * The interval since the previous sample is integrated with the
+     * previous sample's values held constant, split at any phase markers
+     * in between.
+     *
+     * @param nowMs Sample time in milliseconds
+     * @param current Current reading
+     * @param voltage Bus voltage reading
+     */
+    void addSample(uint32_t nowMs, float current, float voltage) {
+        advance(nowMs);
+        lastCurrent = current;
+        lastVoltage = voltage;
+        hasSample = true;
+    }
+
+    uint8_t getPhaseCount() const { return count; }
+
+    /**
+     * @brief Access the totals of one phase
+     * @param id Phase id, 0 .. getPhaseCount() - 1
+     * @return Phase totals
+     */
+    const Phase &getPhase(uint8_t id) const { return phases[id]; }
+
+    double getBaselineEnergy() const { return baselineEnergy; }
+
+    double getBaselineCharge() const { return baselineCharge; }
+
+    uint32_t getBaselineMs() const { return baselineMs; }
+
+    /**
+     * @brief Write a per-phase energy report as text
+     * @param buffer Destination buffer
+     * @param size Size of buffer in bytes
+     * @return Number of characters that would have been written (as snprintf)
+     */
+    int formatReport(char *buffer, size_t size) const {
+        int total = 0;
+        for (uint8_t i = 0; i <= count; i++) {
+            const bool base = (i == count);
+            const char *name = base ? "baseline" : phases[i].name;
+            const double energy = base ? baselineEnergy : phases[i].energy;
+            const double charge = base ? baselineCharge : phases[i].charge;
+            const uint32_t ms = base ? baselineMs : phases[i].activeMs;
+            const uint32_t entries = base ? 0 : phases[i].entries;
+            const size_t offset = (total < (int)size) ? total : size;
+            const int n = snprintf(buffer + offset, size - offset, "%s: E=%.3f Q=%.3f t=%lums n=%lu\n",
+                                   name, energy, charge, (unsigned long)ms, (unsigned long)entries);
+            if (n < 0) return n;
+            total += n;
+        }
+        return total;
+    }
+
+private:
+    int lookup(const char *name, bool create) {
+        for (uint8_t i = 0; i < count; i++) {
+            if (phases[i].name == name || strcmp(phases[i].name, name) == 0) return i;
+        }
+        if (!create || count >= MaxPhases) return NO_PHASE;
+        Phase &p = phases[count];
+        p.name = name;
+        p.energy = 0;
+        p.charge = 0;
+        p.activeMs = 0;
+        p.entries = 0;
+        p.depth = 0;
+        return count++;
+    }
+
+    // Integrate from the last timestamp up to nowMs and attribute it to the active phases
+    void advance(uint32_t nowMs) {
+        if (!hasTime) {
+            hasTime = true;
+            lastMs = nowMs;
+            return;
+        }
+        const uint32_t dtMs = nowMs - lastMs;
+        lastMs = nowMs;
+        if (dtMs == 0) return;
+        const double seconds = dtMs / 1000.0;
+        const double charge = hasSample ? lastCurrent * seconds : 0;
+        const double energy = hasSample ? lastCurrent * lastVoltage * seconds : 0;
+        if (activeCount == 0) {
+            baselineEnergy += energy;
+            baselineCharge += charge;
+            baselineMs += dtMs;
+            return;
+        }
+        for (uint8_t i = 0; i < count; i++) {
+            if (phases[i].depth == 0) continue;
+            phases[i].energy += energy;
+            phases[i].charge += charge;
+            phases[i].activeMs += dtMs;
+        }
+    }
+
+    Phase phases[MaxPhases];
+    uint8_t channel;
+    uint8_t count;       // Phases in use
+    uint8_t activeCount; // Phases with depth > 0
+    bool hasSample;
+    bool hasTime;        // lastMs holds a valid timestamp
+    uint32_t lastMs;
+    float lastCurrent;   // Most recent sample, held until the next one
+    float lastVoltage;
+    double baselineEnergy;
+    double baselineCharge;
+    uint32_t baselineMs;
+};
+
+#endif // POWER_PROFILER_H
@@ -0,0 +1,233 @@
+/**
+ * @file RailAnomalyDetector.h
+ * @brief Brownout, overcurrent and stuck-reading detection on CSA channels
+ *
+ * Tracks an exponentially weighted moving average of bus voltage and
+ * current on each CSA channel and compares every new reading with it:
+ *
+ * - Sag: bus voltage drops more than a fraction below its baseline
+ * - Overcurrent: current rises more than a margin above its baseline
+ * - Stuck: the same reading (bit-identical voltage and current) repeats
+ *   for a number of samples, e.g. a hung converter or bus. A channel
+ *   reading exactly 0 V and 0 A is treated as unused, not stuck.
+ *
+ * One compact event record is queued when an excursion starts; the
+ * channel re-arms once the reading is back in range. The baseline is
+ * frozen while a channel is out of range so a long sag does not become
+ * the new normal. Events go through a SampleRing so detection can run in
+ * a sampling context while a logging context drains them at a low rate.
+ *
+ * © 2025 Regents of the University of Minnesota. All rights reserved.
+ */
+
+#ifndef RAIL_ANOMALY_DETECTOR_H
+#define RAIL_ANOMALY_DETECTOR_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "ICurrentSenseAmplifier.h"
+#include "SampleRing.h"
+
+enum RailAnomalyType {
+    RAIL_SAG = 0,
+    RAIL_OVERCURRENT = 1,
+    RAIL_STUCK = 2,
+};
+
+/**
+ * @brief Per-channel rail anomaly detector
+ *
+ * @tparam EventCapacity Events buffered between detection and popEvent(), a power of two
+ */
+template <size_t EventCapacity>
+class RailAnomalyDetector {
+public:
+    /**
+     * @brief One detected anomaly
+     */
+    struct Event {
+        uint32_t time;    // Time of the first out-of-range reading, milliseconds
+        uint8_t channel;  // IChannel
+        uint8_t type;     // RailAnomalyType
+        float value;      // Offending reading (voltage for sags and stuck, current for overcurrent)
+        float baseline;   // Baseline at the time of the event
+    };
+
+    /**
+     * @brief Construct a detector
+     * @param sagFraction Fractional drop below the voltage baseline that counts as a sag
+     * @param overcurrentMargin Rise above the current baseline that counts as overcurrent, in getCurrent() units
+     * @param stuckCount Identical consecutive readings that count as stuck, 0 to disable
+     * @param alpha EWMA weight of each new reading, 0 < alpha <= 1
+     */
+    RailAnomalyDetector(float sagFraction = 0.1f, float overcurrentMargin = 100.0f,
+                        uint16_t stuckCount = 32, float alpha = 0.05f)
+        : sagLimit(sagFraction), spikeLimit(overcurrentMargin), stuckLimit(stuckCount),
+          weight((alpha > 0 && alpha <= 1) ? alpha : 0.05f), readFailures(0) {
+        reset();
+    }
+
+    /**
+     * @brief Forget all baselines; detection restarts after the warm-up
+     */
+    void reset() {
+        for (uint8_t i = 0; i < CSA_NUM_CHANNELS; i++) {
+            Channel &c = channels[i];
+            c.voltage = 0;
+            c.current = 0;
+            c.lastVoltage = 0;
+            c.lastCurrent = 0;
+            c.samples = 0;
+            c.repeats = 0;
+            c.active = 0;
+        }
+    }
+
+    /**
+     * @brief Refresh the device, then read and check the selected channels
+     * @param csa Current sense amplifier to read
+     * @param nowMs Current time in milliseconds
+     * @param channelMask Bit (1 << IChannel) set for each channel to check
+     * @return Number of events queued by this call
+     */
+    uint8_t poll(ICurrentSenseAmplifier &csa, uint32_t nowMs, uint8_t channelMask = 0x0F) {
+        csa.update(); // Latch a new conversion; no Clear so accumulators are kept
+        uint8_t events = 0;
+        for (uint8_t unit = 0; unit < CSA_NUM_CHANNELS; unit++) {
+            if (!(channelMask & (1 << unit))) continue;
+            const Result<float> voltage = csa.readBusVoltage(unit);
+            const Result<float> current = csa.readCurrent(unit);
+            if (!voltage.ok() || !current.ok()) {
+                readFailures++;
+                continue;
+            }
+            events += addSample(unit, nowMs, voltage.value, current.value);
+        }
+        return events;
+    }
+
+    /**
+     * @brief Check one reading (device path via poll(), or host replay)
+     * @param unit Channel (IChannel)
+     * @param nowMs Reading time in milliseconds
+     * @param voltage Bus voltage
+     * @param current Current
+     * @return Number of events queued
+     */
+    uint8_t addSample(uint8_t unit, uint32_t nowMs, float voltage, float current) {
+        if (unit >= CSA_NUM_CHANNELS) return 0;
+        Channel &c = channels[unit];
+        if (c.samples == 0) {
+            c.voltage = voltage;
+            c.current = current;
+        }
+        uint8_t events = 0;
+
+        const bool idle = (voltage == 0 && current == 0); // Unused channel
+        if (stuckLimit > 0 && c.samples > 0 && !idle && voltage == c.lastVoltage && current == c.lastCurrent) {
+            if (c.repeats < 0xFFFF) c.repeats++;
+        } else {
+            c.repeats = 0;
+            c.active &= ~(1 << RAIL_STUCK);
+        }
+        c.lastVoltage = voltage;
+        c.lastCurrent = current;
+
+        if (c.samples < WARMUP) {
+            c.samples++;
+            learn(c, voltage, current);
+            return 0;
+        }
+
+        const bool sag = voltage < c.voltage * (1.0f - sagLimit);
+        const bool spike = current > c.current + spikeLimit;
+        const bool stuck = stuckLimit > 0 && c.repeats + 1 >= stuckLimit;
+        events += check(c, unit, nowMs, RAIL_SAG, sag, voltage, c.voltage);
+        events += check(c, unit, nowMs, RAIL_OVERCURRENT, spike, current, c.current);
+        events += check(c, unit, nowMs, RAIL_STUCK, stuck, voltage, c.voltage);
+
+        // Only normal readings move the baseline
+        if (!c.active) learn(c, voltage, current);
+        return events;
+    }
+
+    /**
+     * @brief Take the oldest queued event (logging context only)
+     * @param event Populated with the event
+     * @return true if an event was available
+     */
+    bool popEvent(Event &event) { return queue.pop(event); }
+
+    /**
+     * @brief Check whether a channel is currently in an anomaly
+     * @param unit Channel (IChannel)
+     * @param type RailAnomalyType
+     * @return true while the excursion is ongoing
+     */
+    bool isActive(uint8_t unit, uint8_t type) const {
+        return unit < CSA_NUM_CHANNELS && (channels[unit].active & (1 << type));
+    }
+
+    float getVoltageBaseline(uint8_t unit) const { return (unit < CSA_NUM_CHANNELS) ? channels[unit].voltage : 0; }
+
+    float getCurrentBaseline(uint8_t unit) const { return (unit < CSA_NUM_CHANNELS) ? channels[unit].current : 0; }
+
+    /**
+     * @brief Events lost because popEvent() did not keep up
+     * @return Dropped event count
+     */
+    uint32_t getDroppedEvents() const { return queue.getOverflows(); }
+
+    /**
+     * @brief Polls skipped because a read failed
+     * @return Failure count
+     */
+    uint32_t getReadFailures() const { return readFailures; }
+
+private:
+    static constexpr uint16_t WARMUP = 8; // Readings used to seed the baseline before checking
+
+    struct Channel {
+        float voltage;      // Bus voltage baseline (EWMA)
+        float current;      // Current baseline (EWMA)
+        float lastVoltage;
+        float lastCurrent;
+        uint16_t samples;   // Readings seen, saturating at WARMUP
+        uint16_t repeats;   // Consecutive readings identical to the previous one
+        uint8_t active;     // Bit (1 << RailAnomalyType) set while an excursion is ongoing
+    };
+
+    void learn(Channel &c, float voltage, float current) {
+        c.voltage += weight * (voltage - c.voltage);
+        c.current += weight * (current - c.current);
+    }
+
+    // Queue an event on the rising edge of a condition, re-arm on the falling edge
+    uint8_t check(Channel &c, uint8_t unit, uint32_t nowMs, uint8_t type, bool condition,
+                  float value, float baseline) {
+        const uint8_t bit = 1 << type;
+        if (!condition) {
+            c.active &= ~bit;
+            return 0;
+        }
+        if (c.active & bit) return 0;
+        c.active |= bit;
+        Event e;
+        e.time = nowMs;
+        e.channel = unit;
+        e.type = type;
+        e.value = value;
+        e.baseline = baseline;
+        return queue.push(e) ? 1 : 0;
+    }
+
+    SampleRing<Event, EventCapacity> queue;
+    Channel channels[CSA_NUM_CHANNELS];
+    float sagLimit;
+    float spikeLimit;
+    uint16_t stuckLimit;
+    float weight;
+    uint32_t readFailures;
+};
+
+#endif // RAIL_ANOMALY_DETECTOR_H
@@ -0,0 +1,70 @@
+/**
+ * @file Result.h
+ * @brief Value plus error code returned together from sensor reads
+ *
+ * Replaces the pattern of a float return with a separate bool &Stat
+ * out-parameter. The struct is a trivially copyable aggregate with no
+ * constructors, allocation or exceptions, so it can be returned by value
+ * from interrupt and driver code.
+ *
+ * It is not free: Result<float> is an 8-byte composite, which AAPCS
+ * (Cortex-M) returns through a caller stack slot rather than in s0 as a
+ * bare float is, costing a store and a load per call. That is small next
+ * to the bus transaction behind a read, but it is not zero-overhead.
+ *
+ * Typical use:
+ * @code
+ * Result<float> current = csa.readCurrent(CSA_CH1);
+ * if (current.ok()) log(current.value);
+ * else logError(current.error);
+ * @endcode
+ *
+ * © 2025 Regents of the University of Minnesota. All rights reserved.
+ */
+
+#ifndef RESULT_H
+#define RESULT_H
+
+#include <stdint.h>
+
+/**
+ * @brief Error codes carried by Result
+ */
+enum ResultError {
+    RESULT_OK = 0,
+    RESULT_READ_FAILED = 1,     // Bus transaction or conversion failed
+    RESULT_INVALID_CHANNEL = 2, // Channel argument out of range
+    RESULT_NOT_SUPPORTED = 3,   // Device does not provide this measurement
+};
+
+/**
+ * @brief Measured value and the status of the read that produced it
+ *
+ * @tparam T Value type
+ */
+template <typename T>
+struct Result {
+    T value;       // Measured value, meaningful only when ok()
+    uint8_t error; // ResultError, RESULT_OK on success
+
+    bool ok() const { return error == RESULT_OK; }
+
+    /**
+     * @brief Value if the read succeeded, otherwise a caller-chosen fallback
+     * @param fallback Value returned on error
+     * @return value or fallback
+     */
+    T valueOr(T fallback) const { return ok() ? value : fallback; }
+
+    static Result success(T v) {
+        Result r = {v, RESULT_OK};
+        return r;
+    }
+
+    static Result failure(uint8_t code, T v = T()) {
+        Result r = {v, code};
+        return r;
+    }
+};
+
+#endif // RESULT_H
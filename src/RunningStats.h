@@ -0,0 +1,167 @@
+/**
+ * @file RunningStats.h
+ * @brief Streaming min/max/mean/standard deviation aggregator
+ *
+ * Accumulates scalar sensor readings (getAccel(), getLux(), getCurrent(),
+ * getEvent() fields, ...) with Welford's algorithm so only a summary per
+ * interval needs to be logged. Partial aggregates from separate intervals
+ * or nodes can be merged exactly with merge().
+ *
+ * Typical use:
+ * @code
+ * RunningStats<> current;
+ * bool stat = false;
+ * float value = csa.getCurrent(CSA_CH1, false, stat);
+ * current.add(value, stat);
+ * ...
+ * RunningStats<>::Summary s = current.getSummary(); // once per interval
+ * current.reset();
+ * @endcode
+ *
+ * © 2025 Regents of the University of Minnesota. All rights reserved.
+ */
+
+#ifndef RUNNING_STATS_H
+#define RUNNING_STATS_H
+
+#include <stdint.h>
+#include <math.h>
+
+/**
+ * @brief Welford running statistics
+ *
+ * @tparam Real Accumulator type; float keeps device builds on the FPU,
+ *              double gives more headroom for very long intervals
+ */
+template <typename Real = float>
+class RunningStats {
+public:
+    /**
+     * @brief Summary of an interval
+     */
+    struct Summary {
+        uint32_t count;   // Number of valid readings
+        uint32_t invalid; // Number of readings rejected by add(value, valid)
+        Real min;         // Smallest reading, NAN if count is 0
+        Real max;         // Largest reading, NAN if count is 0
+        Real mean;        // Arithmetic mean, NAN if count is 0
+        Real stddev;      // Sample standard deviation, 0 if count < 2
+    };
+
+    RunningStats() { reset(); }
+
+    /**
+     * @brief Clear all accumulated readings
+     */
+    void reset() {
+        n = 0;
+        rejected = 0;
+        mu = 0;
+        m2 = 0;
+        lo = 0;
+        hi = 0;
+    }
+
+    /**
+     * @brief Add one reading
+     * @param value Reading to accumulate
+     */
+    void add(Real value) {
+        if (n == 0) {
+            lo = value;
+            hi = value;
+        } else {
+            if (value < lo) lo = value;
+            if (value > hi) hi = value;
+        }
+        n++;
+        const Real delta = value - mu;
+        mu += delta / n;
+        m2 += delta * (value - mu);
+    }
+
+    /**
+     * @brief Add one reading together with its driver status
+     *
+     * Matches the bool status conventions used across the interfaces,
+     * e.g. ICurrentSenseAmplifier's Stat out-parameter.
+     *
+     * @param value Reading to accumulate
+     * @param valid false to count the reading as invalid and skip it
+     */
+    void add(Real value, bool valid) {
+        if (valid) {
+            add(value);
+        } else {
+            rejected++;
+        }
+    }
+
+    /**
+     * @brief Combine another aggregate into this one
+     *
+     * The result is the same as if every reading of other had been added
+     * to this aggregate (up to floating point rounding).
+     *
+     * @param other Aggregate to merge in
+     */
+    void merge(const RunningStats& other) {
+        rejected += other.rejected;
+        if (other.n == 0) return;
+        if (n == 0) {
+            const uint32_t keep = rejected;
+            *this = other;
+            rejected = keep;
+            return;
+        }
+        const uint32_t total = n + other.n;
+        const Real delta = other.mu - mu;
+        const Real weight = (Real)other.n / total;
+        mu += delta * weight;
+        m2 += other.m2 + delta * delta * n * weight;
+        if (other.lo < lo) lo = other.lo;
+        if (other.hi > hi) hi = other.hi;
+        n = total;
+    }
+
+    uint32_t getCount() const { return n; }
+
+    Real getMean() const { return (n > 0) ? mu : (Real)NAN; }
+
+    Real getMin() const { return (n > 0) ? lo : (Real)NAN; }
+
+    Real getMax() const { return (n > 0) ? hi : (Real)NAN; }
+
+    /**
+     * @brief Sample variance of the readings
+     * @return Variance, 0 if fewer than two readings
+     */
+    Real getVariance() const { return (n > 1) ? m2 / (n - 1) : 0; }
+
+    Real getStddev() const { return sqrt(getVariance()); }
+
+    /**
+     * @brief Snapshot of the current interval
+     * @return Summary of all readings since the last reset()
+     */
+    Summary getSummary() const {
+        Summary s;
+        s.count = n;
+        s.invalid = rejected;
+        s.min = getMin();
+        s.max = getMax();
+        s.mean = getMean();
+        s.stddev = getStddev();
+        return s;
+    }
+
+private:
+    uint32_t n;        // Valid readings
+    uint32_t rejected; // Invalid readings
+    Real mu;           // Running mean
+    Real m2;           // Sum of squared deviations from the mean
+    Real lo;
+    Real hi;
+};
+
+#endif // RUNNING_STATS_H
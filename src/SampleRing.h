@@ -0,0 +1,138 @@
+/**
+ * @file SampleRing.h
+ * @brief Lock-free single-producer/single-consumer ring buffer
+ *
+ * Fixed-capacity, allocation-free queue for handing samples from an
+ * interrupt context (e.g. an accelerometer data-ready ISR calling
+ * updateAccelAll()) to a logging task. Exactly one context may push and
+ * exactly one context may pop; no locks or interrupt masking are needed.
+ *
+ * Typical use:
+ * @code
+ * SampleRing<IAccelerometer::Sample, 256> ring;
+ *
+ * void onDataReady() { // ISR
+ *     if (accel.updateAccelAll() == 0) {
+ *         const float* d = accel.getData();
+ *         ring.push({millis(), d[0], d[1], d[2]});
+ *     }
+ * }
+ *
+ * void loggerTask() {
+ *     IAccelerometer::Sample batch[32];
+ *     size_t n = ring.popBatch(batch, 32);
+ *     // ... write n samples ...
+ * }
+ * @endcode
+ *
+ * © 2025 Regents of the University of Minnesota. All rights reserved.
+ */
+
+#ifndef SAMPLE_RING_H
+#define SAMPLE_RING_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+/**
+ * @brief SPSC ring buffer with overflow accounting
+ *
+ * @tparam T Element type, must be trivially copyable
+ * @tparam Capacity Number of slots, must be a power of two
+ *
+ * When the ring is full, push() drops the new element and increments the
+ * overflow counter rather than overwriting data the consumer has not read.
+ */
+template <typename T, size_t Capacity>
+class SampleRing {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                  "SampleRing capacity must be a power of two");
+
+public:
+    SampleRing() : head(0), tail(0), overflows(0) {}
+
+    /**
+     * @brief Append an element (producer side only)
+     * @param item Element to copy into the ring
+     * @return true if stored, false if the ring was full and item was dropped
+     */
+    bool push(const T& item) {
+        const uint32_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) >= Capacity) {
+            overflows.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        slots[h & MASK] = item;
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Remove the oldest element (consumer side only)
+     * @param item Receives the element
+     * @return true if an element was available, false if the ring was empty
+     */
+    bool pop(T& item) {
+        const uint32_t t = tail.load(std::memory_order_relaxed);
+        if (head.load(std::memory_order_acquire) == t) return false;
+        item = slots[t & MASK];
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Remove up to maxCount elements in one call (consumer side only)
+     * @param buffer Caller-owned array to receive elements, oldest first
+     * @param maxCount Capacity of buffer
+     * @return Number of elements written to buffer
+     */
+    size_t popBatch(T* buffer, size_t maxCount) {
+        const uint32_t t = tail.load(std::memory_order_relaxed);
+        size_t available = head.load(std::memory_order_acquire) - t;
+        if (available > maxCount) available = maxCount;
+        for (size_t i = 0; i < available; i++) {
+            buffer[i] = slots[(t + i) & MASK];
+        }
+        tail.store(t + (uint32_t)available, std::memory_order_release);
+        return available;
+    }
+
+    /**
+     * @brief Number of elements currently queued
+     * @return Element count (a snapshot, may change concurrently)
+     */
+    size_t size() const {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+
+    bool empty() const { return size() == 0; }
+
+    static constexpr size_t capacity() { return Capacity; }
+
+    /**
+     * @brief Number of elements dropped because the ring was full
+     * @return Overflow count since construction or last resetOverflows()
+     */
+    uint32_t getOverflows() const {
+        return overflows.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Read and clear the overflow counter (consumer side)
+     * @return Overflow count before clearing
+     */
+    uint32_t resetOverflows() {
+        return overflows.exchange(0, std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr uint32_t MASK = Capacity - 1;
+
+    T slots[Capacity];
+    std::atomic<uint32_t> head;      // Written only by the producer
+    std::atomic<uint32_t> tail;      // Written only by the consumer
+    std::atomic<uint32_t> overflows; // Incremented only by the producer
+};
+
+#endif // SAMPLE_RING_H
@@ -0,0 +1,215 @@
+/**
+ * @file ShockCapture.h
+ * @brief Shock event capture with pre-trigger history for accelerometers
+ *
+ * Keeps a rolling window of recent accelerometer samples and, when the
+ * acceleration magnitude leaves a configurable band, freezes that history
+ * plus a fixed number of post-trigger samples as an event. The event is
+ * read straight out of the ring storage (as at most two contiguous
+ * segments), so nothing is copied until the caller persists it.
+ *
+ * © 2025 Regents of the University of Minnesota. All rights reserved.
+ */
+
+#ifndef SHOCK_CAPTURE_H
+#define SHOCK_CAPTURE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <math.h>
+#include "IAccelerometer.h"
+
+/**
+ * @brief Threshold-triggered event recorder
+ *
+ * @tparam PreTrigger Number of samples kept from before the trigger sample
+ * @tparam PostTrigger Number of samples recorded after the trigger sample
+ *
+ * An event holds up to PreTrigger + 1 + PostTrigger samples. While an event
+ * is waiting to be read, new samples are counted as missed and discarded;
+ * call rearm() once the event has been persisted.
+ */
+template <size_t PreTrigger, size_t PostTrigger>
+class ShockCapture {
+public:
+    /**
+     * @brief Capture state
+     */
+    enum class State : uint8_t {
+        Armed = 0,     // Recording history, waiting for a trigger
+        Triggered = 1, // Recording post-trigger samples
+        Ready = 2      // Event frozen and available to read
+    };
+
+    /**
+     * @brief Summary of a captured event
+     */
+    struct Event {
+        uint32_t triggerTime; // Timestamp of the trigger sample
+        float peakMagnitude;  // Largest magnitude seen during the event in g
+        size_t preCount;      // Samples available before the trigger (<= PreTrigger)
+        size_t count;         // Total samples in the event including the trigger
+    };
+
+    /**
+     * @brief Construct an armed capture that triggers at a 2 g raw magnitude
+     */
+    ShockCapture() : state(State::Armed), head(0), history(0), postRemaining(0),
+                     eventStart(0), upperSq(4.0f), lowerSq(-1.0f), peakSq(0),
+                     events(0), missed(0) {}
+
+    /**
+     * @brief Set the trigger band
+     *
+     * The capture triggers when |a| >= reference + threshold, or when
+     * |a| <= reference - threshold if that is positive. Use reference = 1
+     * to trigger on deviation from gravity, 0 for raw magnitude.
+     *
+     * @param threshold Trigger distance from the reference in g
+     * @param reference Resting magnitude in g
+     */
+    void setThreshold(float threshold, float reference = 0) {
+        const float upper = reference + threshold;
+        const float lower = reference - threshold;
+        upperSq = upper * upper;
+        lowerSq = (lower > 0) ? lower * lower : -1.0f;
+    }
+
+    /**
+     * @brief Add one sample
+     * @param sample Acceleration sample in g units
+     * @return true if this sample completed an event
+     */
+    bool addSample(const IAccelerometer::Sample& sample) {
+        if (state == State::Ready) {
+            missed++;
+            return false;
+        }
+        const float magSq = sample.x * sample.x + sample.y * sample.y + sample.z * sample.z;
+        const size_t index = head;
+        storage[index] = sample;
+        head = (head + 1 == CAPACITY) ? 0 : head + 1;
+
+        if (state == State::Armed) {
+            if (magSq < upperSq && magSq > lowerSq) {
+                if (history < PreTrigger) history++;
+                return false;
+            }
+            state = State::Triggered;
+            event.triggerTime = sample.time;
+            event.preCount = history;
+            eventStart = (index + CAPACITY - history) % CAPACITY;
+            peakSq = magSq;
+            postRemaining = PostTrigger;
+        } else {
+            if (magSq > peakSq) peakSq = magSq;
+            postRemaining--;
+        }
+
+        if (postRemaining > 0) return false;
+        event.count = event.preCount + 1 + PostTrigger;
+        event.peakMagnitude = sqrtf(peakSq);
+        state = State::Ready;
+        events++;
+        return true;
+    }
+
+    /**
+     * @brief Read up to 16 samples from the accelerometer into the capture
+     *
+     * Reads a single chunk so one call has bounded cost; call it at least
+     * as often as the sensor FIFO fills by 16 samples, or repeatedly, to
+     * keep up with a deeper FIFO.
+     *
+     * @param accel Accelerometer to read with readSamples()
+     * @return true if an event is ready to read
+     */
+    bool poll(IAccelerometer& accel) {
+        IAccelerometer::Sample chunk[CHUNK];
+        const size_t count = accel.readSamples(chunk, CHUNK);
+        for (size_t i = 0; i < count; i++) {
+            addSample(chunk[i]);
+        }
+        return state == State::Ready;
+    }
+
+    State getState() const { return state; }
+
+    /**
+     * @brief Get the summary of the ready event
+     * @return Event summary, only meaningful when getState() is State::Ready
+     */
+    const Event& getEvent() const { return event; }
+
+    /**
+     * @brief Access one sample of the ready event
+     * @param i Sample index, 0 is the oldest pre-trigger sample
+     * @return Reference into the ring storage
+     */
+    const IAccelerometer::Sample& getEventSample(size_t i) const {
+        return storage[(eventStart + i) % CAPACITY];
+    }
+
+    /**
+     * @brief Get the ready event as at most two contiguous segments
+     * @param first Set to the start of the first (oldest) segment
+     * @param firstCount Set to the number of samples in the first segment
+     * @param second Set to the start of the second segment
+     * @param secondCount Set to the number of samples in the second segment (may be 0)
+     */
+    void getEventSegments(const IAccelerometer::Sample*& first, size_t& firstCount,
+                          const IAccelerometer::Sample*& second, size_t& secondCount) const {
+        const size_t untilWrap = CAPACITY - eventStart;
+        first = storage + eventStart;
+        second = storage;
+        if (event.count <= untilWrap) {
+            firstCount = event.count;
+            secondCount = 0;
+        } else {
+            firstCount = untilWrap;
+            secondCount = event.count - untilWrap;
+        }
+    }
+
+    /**
+     * @brief Release the ready event and resume recording
+     *
+     * History restarts empty so the next event never contains samples from
+     * before the previous one was frozen.
+     */
+    void rearm() {
+        state = State::Armed;
+        history = 0;
+    }
+
+    /**
+     * @brief Number of events captured since construction
+     * @return Event count
+     */
+    uint32_t getEventCount() const { return events; }
+
+    /**
+     * @brief Number of samples discarded while an event was waiting to be read
+     * @return Missed sample count
+     */
+    uint32_t getMissedSamples() const { return missed; }
+
+private:
+    static constexpr size_t CAPACITY = PreTrigger + 1 + PostTrigger;
+    static constexpr size_t CHUNK = 16; // Samples read per poll()
+
+    IAccelerometer::Sample storage[CAPACITY];
+    State state;
+    size_t head;          // Next slot to write
+    size_t history;       // Valid pre-trigger samples currently held
+    size_t postRemaining; // Post-trigger samples still to record
+    size_t eventStart;    // Slot of the oldest sample in the event
+    float upperSq;        // Squared upper trigger magnitude
+    float lowerSq;        // Squared lower trigger magnitude, negative if disabled
+    float peakSq;         // Largest squared magnitude during the event
+    Event event;
+    uint32_t events;
+    uint32_t missed;
+};
+
+#endif // SHOCK_CAPTURE_H
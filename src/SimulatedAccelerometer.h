@@ -0,0 +1,310 @@
+/**
+ * @file SimulatedAccelerometer.h
+ * @brief Deterministic accelerometer simulator for host-side testing
+ *
+ * Concrete IAccelerometer that synthesizes samples in virtual time instead
+ * of talking to hardware. The signal is the sum of a slowly tilting
+ * gravity vector, sinusoidal vibration tones, half-sine shock pulses and
+ * Gaussian noise; getTemp() follows a sinusoidal daily cycle. Each
+ * updateAccelAll(), readSamples() or readRawSamples() call advances the
+ * virtual clock by whole sample periods, so hours of data can be pushed
+ * through downstream stages as fast as the host can compute it; getAccel()
+ * returns the latched sample without advancing time.
+ * The same seed always produces the same sample stream.
+ *
+ * © 2025 Regents of the University of Minnesota. All rights reserved.
+ */
+
+#ifndef SIMULATED_ACCELEROMETER_H
+#define SIMULATED_ACCELEROMETER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <math.h>
+#include "IAccelerometer.h"
+
+/**
+ * @brief Virtual-time accelerometer with configurable signal models
+ */
+class SimulatedAccelerometer : public IAccelerometer {
+public:
+    static constexpr uint8_t MAX_TONES = 4;
+    static constexpr uint8_t MAX_SHOCKS = 8;
+    static constexpr uint8_t AXIS_ALL = 3; // Apply a tone or shock to all three axes
+
+    /**
+     * @brief Construct a simulator at rest, level, with no noise
+     * @param sampleRateHz Output data rate in Hz
+     * @param seed Seed for the noise generator (must be non-zero)
+     */
+    explicit SimulatedAccelerometer(float sampleRateHz = 100, uint32_t seed = 1)
+        : rate(sampleRateHz), periodUs(1e6 / sampleRateHz), timeUs(0), rng(seed ? seed : 1),
+          noise(0), tiltRate(0), tempBase(25), tempSwing(0), tempPeriodS(86400),
+          fifoDepth(32), currentRange(0), numTones(0), numShocks(0) {
+        for (int i = 0; i < 3; i++) {
+            data[i] = 0;
+            offset[i] = 0;
+            latched[i] = 0;
+        }
+    }
+
+    /**
+     * @brief Set the standard deviation of the white noise on each axis
+     * @param stddevG Noise standard deviation in g
+     */
+    void setNoise(float stddevG) { noise = stddevG; }
+
+    /**
+     * @brief Add a sinusoidal vibration component
+     * @param axis Axis to apply it to (0=X, 1=Y, 2=Z, AXIS_ALL)
+     * @param freqHz Tone frequency in Hz
+     * @param amplitudeG Peak amplitude in g
+     * @return true on success, false if MAX_TONES are already defined
+     */
+    bool addTone(uint8_t axis, float freqHz, float amplitudeG) {
+        if (numTones >= MAX_TONES) return false;
+        tones[numTones].axis = axis;
+        tones[numTones].omega = 2 * PI_D * freqHz;
+        tones[numTones].amplitude = amplitudeG;
+        numTones++;
+        return true;
+    }
+
+    /**
+     * @brief Schedule a half-sine shock pulse
+     * @param timeMs Virtual time the pulse starts, in ms
+     * @param axis Axis to apply it to (0=X, 1=Y, 2=Z, AXIS_ALL)
+     * @param peakG Peak acceleration of the pulse in g
+     * @param durationMs Pulse length in ms
+     * @return true on success, false if MAX_SHOCKS are already scheduled
+     */
+    bool addShock(uint32_t timeMs, uint8_t axis, float peakG, float durationMs) {
+        if (numShocks >= MAX_SHOCKS) return false;
+        shocks[numShocks].startUs = (double)timeMs * 1000;
+        shocks[numShocks].durationUs = (double)durationMs * 1000;
+        shocks[numShocks].axis = axis;
+        shocks[numShocks].peak = peakG;
+        numShocks++;
+        return true;
+    }
+
+    /**
+     * @brief Set the rate at which gravity rotates from +Z toward +Y
+     * @param degreesPerHour Tilt drift rate
+     */
+    void setTiltDrift(float degreesPerHour) { tiltRate = degreesPerHour * PI_D / 180 / 3600; }
+
+    /**
+     * @brief Configure the simulated sensor temperature
+     * @param baseC Mean temperature in degrees Celsius
+     * @param swingC Peak deviation from the mean in degrees Celsius
+     * @param periodHours Length of one temperature cycle in hours
+     */
+    void setTemperature(float baseC, float swingC, float periodHours = 24) {
+        tempBase = baseC;
+        tempSwing = swingC;
+        tempPeriodS = periodHours * 3600;
+    }
+
+    /**
+     * @brief Set the number of samples returned by one readSamples() call
+     * @param depth Simulated hardware FIFO depth
+     */
+    void setFifoDepth(size_t depth) { fifoDepth = depth; }
+
+    /**
+     * @brief Set the range used for readSamples() and readRawSamples()
+     * @param newRange Range setting, full scale is +/-(2 << newRange) g
+     */
+    void setRange(uint8_t newRange) { currentRange = newRange; }
+
+    float getSampleRate() const { return rate; }
+
+    /**
+     * @brief Get the virtual time of the next sample
+     * @return Virtual time in microseconds since construction
+     */
+    double getTimeUs() const { return timeUs; }
+
+    /**
+     * @brief Move the virtual clock forward without producing samples
+     * @param ms Milliseconds to skip
+     */
+    void skip(uint32_t ms) { timeUs += (double)ms * 1000; }
+
+    int begin() override { return 0; }
+
+    /**
+     * @brief Return one axis of the sample latched by the last updateAccelAll() or readSamples()
+     *
+     * Does not advance time, so reading X, Y and Z returns one sample.
+     *
+     * @param axis Axis to read (0=X, 1=Y, 2=Z)
+     * @param range Sensitivity range setting, output clips at +/-(2 << range) g
+     * @return Acceleration in g units
+     */
+    float getAccel(uint8_t axis, uint8_t range = 0) override {
+        if (axis > 2) return 0;
+        return clip(latched[axis], range) - offset[axis];
+    }
+
+    int updateAccelAll() override {
+        next(currentRange);
+        return 0;
+    }
+
+    float getTemp() override {
+        return tempBase + tempSwing * sin(2 * PI_D * (timeUs / 1e6) / tempPeriodS);
+    }
+
+    float* getData() override { return data; }
+
+    float* getOffset() override { return offset; }
+
+    void setOffset(float offsetX, float offsetY, float offsetZ) override {
+        offset[0] = offsetX;
+        offset[1] = offsetY;
+        offset[2] = offsetZ;
+    }
+
+    size_t readSamples(Sample* buffer, size_t maxCount) override {
+        const size_t count = (maxCount < fifoDepth) ? maxCount : fifoDepth;
+        for (size_t i = 0; i < count; i++) {
+            buffer[i] = next(currentRange);
+        }
+        return count;
+    }
+
+    size_t readRawSamples(RawSample* buffer, size_t maxCount) override {
+        const size_t count = (maxCount < fifoDepth) ? maxCount : fifoDepth;
+        const float countsPerG = 1.0f / getScale(currentRange);
+        for (size_t i = 0; i < count; i++) {
+            const uint32_t time = (uint32_t)(timeUs / 1000);
+            float raw[3];
+            synthesize(raw);
+            buffer[i].time = time;
+            buffer[i].x = toCounts(raw[0] * countsPerG);
+            buffer[i].y = toCounts(raw[1] * countsPerG);
+            buffer[i].z = toCounts(raw[2] * countsPerG);
+            buffer[i].range = currentRange;
+        }
+        return count;
+    }
+
+    float getScale(uint8_t range) override {
+        return (float)(2 << range) / 32768.0f;
+    }
+
+private:
+    static constexpr double PI_D = 3.14159265358979323846;
+
+    struct Tone {
+        uint8_t axis;
+        double omega;    // Angular frequency in rad/s
+        float amplitude; // Peak amplitude in g
+    };
+
+    struct Shock {
+        double startUs;
+        double durationUs;
+        uint8_t axis;
+        float peak; // Peak acceleration in g
+    };
+
+    // Generate the true (unclipped, uncorrected) acceleration and advance time
+    void synthesize(float out[3]) {
+        const double t = timeUs / 1e6;
+        const double tilt = tiltRate * t;
+        out[0] = 0;
+        out[1] = (float)sin(tilt);
+        out[2] = (float)cos(tilt);
+        for (uint8_t i = 0; i < numTones; i++) {
+            addToAxis(out, tones[i].axis, tones[i].amplitude * (float)sin(tones[i].omega * t));
+        }
+        for (uint8_t i = 0; i < numShocks; i++) {
+            const double dt = timeUs - shocks[i].startUs;
+            if (dt >= 0 && dt < shocks[i].durationUs) {
+                addToAxis(out, shocks[i].axis, shocks[i].peak * (float)sin(PI_D * dt / shocks[i].durationUs));
+            }
+        }
+        if (noise > 0) {
+            for (int a = 0; a < 3; a++) out[a] += noise * gaussian();
+        }
+        timeUs += periodUs;
+    }
+
+    // Produce one offset-corrected, range-clipped sample and latch it into data
+    Sample next(uint8_t sampleRange) {
+        Sample s;
+        s.time = (uint32_t)(timeUs / 1000);
+        float raw[3];
+        synthesize(raw);
+        for (int a = 0; a < 3; a++) {
+            latched[a] = raw[a];
+            data[a] = clip(raw[a], sampleRange) - offset[a];
+        }
+        s.x = data[0];
+        s.y = data[1];
+        s.z = data[2];
+        return s;
+    }
+
+    static float clip(float value, uint8_t sampleRange) {
+        const float fullScale = (float)(2 << sampleRange);
+        if (value > fullScale) return fullScale;
+        if (value < -fullScale) return -fullScale;
+        return value;
+    }
+
+    static void addToAxis(float out[3], uint8_t axis, float value) {
+        if (axis == AXIS_ALL) {
+            out[0] += value;
+            out[1] += value;
+            out[2] += value;
+        } else if (axis < 3) {
+            out[axis] += value;
+        }
+    }
+
+    static int16_t toCounts(float counts) {
+        if (counts >= 32767.0f) return 32767;
+        if (counts <= -32768.0f) return -32768;
+        return (int16_t)lrintf(counts);
+    }
+
+    // xorshift32, deterministic for a given seed
+    uint32_t nextRandom() {
+        rng ^= rng << 13;
+        rng ^= rng >> 17;
+        rng ^= rng << 5;
+        return rng;
+    }
+
+    // Standard normal deviate via Box-Muller
+    float gaussian() {
+        const double u1 = (nextRandom() + 1.0) / 4294967297.0;
+        const double u2 = nextRandom() / 4294967296.0;
+        return (float)(sqrt(-2 * log(u1)) * cos(2 * PI_D * u2));
+    }
+
+    float rate;
+    double periodUs;
+    double timeUs;
+    uint32_t rng;
+    float noise;
+    double tiltRate;  // rad/s
+    float tempBase;
+    float tempSwing;
+    double tempPeriodS;
+    size_t fifoDepth;
+    uint8_t currentRange;
+    float data[3];
+    float latched[3];    // True acceleration of the latest sample, before clipping and offset
+    float offset[3];
+    Tone tones[MAX_TONES];
+    Shock shocks[MAX_SHOCKS];
+    uint8_t numTones;
+    uint8_t numShocks;
+};
+
+#endif // SIMULATED_ACCELEROMETER_H
@@ -0,0 +1,183 @@
+/**
+ * @file UbxPayloadPool.h
+ * @brief Fixed pool of IUbxPacket payload buffers
+ *
+ * Provides MAX_PAYLOAD_SIZE byte buffers for IUbxPacket::payload from a
+ * statically sized pool instead of the heap, so months of UBX exchanges
+ * cannot fragment memory. Buffers are handed out as move-only handles
+ * that return them to the pool when they go out of scope, and clear the
+ * payload pointer of any packet they were attached to.
+ *
+ * The pool is not synchronized; acquire and release buffers from the
+ * single context that talks to the GPS.
+ *
+ * Typical use:
+ * @code
+ * static UbxPayloadPool<4> payloads;
+ *
+ * IUbxPacket packet = {};
+ * UbxPayloadPool<4>::Handle buffer = payloads.acquire();
+ * if (!buffer.attach(packet)) return MEM_ERR;
+ * // ... exchange the packet ...
+ * // buffer released and packet.payload cleared at end of scope
+ * @endcode
+ *
+ * © 2025 Regents of the University of Minnesota. All rights reserved.
+ */
+
+#ifndef UBX_PAYLOAD_POOL_H
+#define UBX_PAYLOAD_POOL_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "IGps.h"
+
+/**
+ * @brief Static pool of UBX payload buffers
+ *
+ * @tparam Buffers Number of MAX_PAYLOAD_SIZE buffers, 1 .. 32
+ */
+template <uint8_t Buffers>
+class UbxPayloadPool {
+    static_assert(Buffers >= 1 && Buffers <= 32, "UbxPayloadPool supports 1 to 32 buffers");
+
+public:
+    /**
+     * @brief Owning reference to one pool buffer
+     *
+     * Move-only; the buffer returns to the pool when the handle is
+     * destroyed, reassigned or release() is called.
+     */
+    class Handle {
+    public:
+        Handle() : pool(nullptr), slot(0), packet(nullptr) {}
+
+        Handle(Handle &&other) : pool(other.pool), slot(other.slot), packet(other.packet) {
+            other.pool = nullptr;
+            other.packet = nullptr;
+        }
+
+        Handle &operator=(Handle &&other) {
+            if (this != &other) {
+                release();
+                pool = other.pool;
+                slot = other.slot;
+                packet = other.packet;
+                other.pool = nullptr;
+                other.packet = nullptr;
+            }
+            return *this;
+        }
+
+        Handle(const Handle &) = delete;
+        Handle &operator=(const Handle &) = delete;
+
+        ~Handle() { release(); }
+
+        /**
+         * @brief Check whether the handle owns a buffer
+         * @return false if acquire() found the pool exhausted or the handle was released
+         */
+        bool valid() const { return pool != nullptr; }
+
+        /**
+         * @brief Get the buffer
+         * @return MAX_PAYLOAD_SIZE bytes, or nullptr if not valid()
+         */
+        uint8_t *data() const { return pool ? pool->buffers[slot] : nullptr; }
+
+        size_t size() const { return pool ? MAX_PAYLOAD_SIZE : 0; }
+
+        /**
+         * @brief Point a packet's payload at this buffer
+         * @param target Packet whose payload is set; cleared again on release
+         * @return true on success, false if not valid()
+         */
+        bool attach(IUbxPacket &target) {
+            if (!pool) return false;
+            if (packet && packet != &target) packet->payload = nullptr;
+            target.payload = pool->buffers[slot];
+            packet = &target;
+            return true;
+        }
+
+        /**
+         * @brief Return the buffer to the pool now
+         */
+        void release() {
+            if (!pool) return;
+            if (packet && packet->payload == pool->buffers[slot]) packet->payload = nullptr;
+            pool->releaseSlot(slot);
+            pool = nullptr;
+            packet = nullptr;
+        }
+
+    private:
+        friend class UbxPayloadPool;
+
+        Handle(UbxPayloadPool *owner, uint8_t index) : pool(owner), slot(index), packet(nullptr) {}
+
+        UbxPayloadPool *pool;
+        uint8_t slot;
+        IUbxPacket *packet; // Packet given to attach(), if any
+    };
+
+    UbxPayloadPool() : used(0), inUse(0), highWater(0), exhaustions(0) {}
+
+    UbxPayloadPool(const UbxPayloadPool &) = delete;
+    UbxPayloadPool &operator=(const UbxPayloadPool &) = delete;
+
+    /**
+     * @brief Take a free buffer
+     * @return Handle owning the buffer; not valid() if every buffer is in use
+     */
+    Handle acquire() {
+        for (uint8_t i = 0; i < Buffers; i++) {
+            const uint32_t bit = 1UL << i;
+            if (used & bit) continue;
+            used |= bit;
+            if (++inUse > highWater) highWater = inUse;
+            return Handle(this, i);
+        }
+        exhaustions++;
+        return Handle();
+    }
+
+    uint8_t getCapacity() const { return Buffers; }
+
+    uint8_t getInUse() const { return inUse; }
+
+    /**
+     * @brief Largest number of buffers in use at once
+     * @return High-water mark since construction or resetStats()
+     */
+    uint8_t getHighWater() const { return highWater; }
+
+    /**
+     * @brief Number of acquire() calls that found the pool empty
+     * @return Exhaustion count since construction or resetStats()
+     */
+    uint32_t getExhaustions() const { return exhaustions; }
+
+    /**
+     * @brief Restart the high-water mark from the current usage and clear exhaustions
+     */
+    void resetStats() {
+        highWater = inUse;
+        exhaustions = 0;
+    }
+
+private:
+    void releaseSlot(uint8_t slot) {
+        used &= ~(1UL << slot);
+        inUse--;
+    }
+
+    uint8_t buffers[Buffers][MAX_PAYLOAD_SIZE];
+    uint32_t used; // Bit i set while buffers[i] is handed out
+    uint8_t inUse;
+    uint8_t highWater;
+    uint32_t exhaustions;
+};
+
+#endif // UBX_PAYLOAD_POOL_H
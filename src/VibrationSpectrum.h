@@ -0,0 +1,246 @@
+/**
+ * @file VibrationSpectrum.h
+ * @brief Streaming vibration spectrum stage for accelerometer data
+ *
+ * Collects fixed-size frames of XYZ samples from an IAccelerometer,
+ * removes the mean (gravity), applies a Hann window and computes a real
+ * FFT per axis. Each completed frame is reduced to per-axis band energies
+ * and a peak frequency so only a handful of numbers need to go upstream
+ * instead of the raw block.
+ *
+ * Window and twiddle tables are computed once at construction; frame
+ * processing uses no trigonometric calls and no allocation.
+ *
+ * © 2025 Regents of the University of Minnesota. All rights reserved.
+ */
+
+#ifndef VIBRATION_SPECTRUM_H
+#define VIBRATION_SPECTRUM_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <math.h>
+#include "IAccelerometer.h"
+
+/**
+ * @brief Windowed FFT spectrum reducer
+ *
+ * @tparam N Frame length in samples, a power of two (at least 8)
+ * @tparam Bands Number of equal-width frequency bands between DC and Nyquist
+ */
+template <size_t N, size_t Bands>
+class VibrationSpectrum {
+    static_assert(N >= 8 && (N & (N - 1)) == 0, "VibrationSpectrum frame length must be a power of two");
+    static_assert(Bands >= 1 && Bands <= N / 2 - 1, "VibrationSpectrum band count must fit in the spectrum");
+
+public:
+    /**
+     * @brief Spectrum summary of one frame
+     */
+    struct Result {
+        uint32_t time;                // Timestamp of the first sample in the frame
+        float bandEnergy[3][Bands];   // Mean-square acceleration per band [axis][band] in g^2
+        float peakHz[3];              // Frequency of the strongest component per axis in Hz
+        float peakAmplitude[3];       // Amplitude of the strongest component per axis in g
+    };
+
+    /**
+     * @brief Construct the stage and precompute window and twiddle tables
+     * @param sampleRateHz Accelerometer output data rate in Hz
+     */
+    explicit VibrationSpectrum(float sampleRateHz) : sampleRate(sampleRateHz), fill(0), frames(0), frameTime(0) {
+        const float pi = 3.14159265358979f;
+        float sum = 0;
+        float sumSq = 0;
+        for (size_t i = 0; i < N; i++) {
+            window[i] = 0.5f - 0.5f * cosf(2 * pi * i / N);
+            sum += window[i];
+            sumSq += window[i] * window[i];
+        }
+        for (size_t k = 0; k < HALF; k++) {
+            twiddleRe[k] = cosf(2 * pi * k / N);
+            twiddleIm[k] = -sinf(2 * pi * k / N);
+        }
+        amplitudeScale = 2.0f / sum;
+        powerScale = 2.0f / (N * sumSq);
+    }
+
+    /**
+     * @brief Add one sample to the current frame
+     * @param sample Acceleration sample in g units
+     * @return true if this sample completed a frame and getResult() was updated
+     */
+    bool addSample(const IAccelerometer::Sample& sample) {
+        if (fill == 0) frameTime = sample.time;
+        frame[0][fill] = sample.x;
+        frame[1][fill] = sample.y;
+        frame[2][fill] = sample.z;
+        if (++fill < N) return false;
+        result.time = frameTime;
+        for (int axis = 0; axis < 3; axis++) {
+            processAxis(axis);
+        }
+        fill = 0;
+        frames++;
+        return true;
+    }
+
+    /**
+     * @brief Read up to 16 samples from the accelerometer into the stage
+     *
+     * Reads a single chunk so one call has bounded cost; call it at least
+     * as often as the sensor FIFO fills by 16 samples, or repeatedly, to
+     * keep up with a deeper FIFO.
+     *
+     * @param accel Accelerometer to read with readSamples()
+     * @return Number of frames completed during this call
+     */
+    size_t poll(IAccelerometer& accel) {
+        IAccelerometer::Sample chunk[CHUNK];
+        const size_t count = accel.readSamples(chunk, CHUNK);
+        size_t completed = 0;
+        for (size_t i = 0; i < count; i++) {
+            if (addSample(chunk[i])) completed++;
+        }
+        return completed;
+    }
+
+    /**
+     * @brief Get the summary of the most recently completed frame
+     * @return Reference to the latest result
+     */
+    const Result& getResult() const { return result; }
+
+    /**
+     * @brief Get the number of frames completed since construction
+     * @return Frame count
+     */
+    uint32_t getFrameCount() const { return frames; }
+
+    /**
+     * @brief Get the frequency of a band's lower edge
+     * @param band Band index
+     * @return Lower edge frequency in Hz
+     */
+    float getBandStartHz(size_t band) const {
+        return bandStartBin(band) * sampleRate / N;
+    }
+
+    /**
+     * @brief Discard any partially collected frame
+     */
+    void reset() { fill = 0; }
+
+private:
+    static constexpr size_t HALF = N / 2;  // Complex FFT length used for the real transform
+    static constexpr size_t CHUNK = 16;    // Samples read per poll()
+
+    // Bins 1..HALF-1 (DC and Nyquist excluded) split evenly across the bands
+    static size_t bandStartBin(size_t band) {
+        return 1 + band * (HALF - 1) / Bands;
+    }
+
+    void processAxis(int axis) {
+        float* data = frame[axis];
+
+        float mean = 0;
+        for (size_t i = 0; i < N; i++) mean += data[i];
+        mean /= N;
+        for (size_t i = 0; i < N; i++) data[i] = (data[i] - mean) * window[i];
+
+        // Treat the real frame as HALF interleaved complex values and transform in place
+        fftComplex(data);
+
+        for (size_t b = 0; b < Bands; b++) result.bandEnergy[axis][b] = 0;
+
+        float peakPower = 0;
+        size_t peakBin = 1;
+        float prevPower = 0;
+        float peakPrev = 0;
+        float peakNext = 0;
+        size_t band = 0;
+        size_t nextBandStart = bandStartBin(1);
+        for (size_t k = 1; k < HALF; k++) {
+            const float power = binPower(data, k);
+            while (band + 1 < Bands && k >= nextBandStart) {
+                band++;
+                nextBandStart = bandStartBin(band + 1);
+            }
+            result.bandEnergy[axis][band] += power * powerScale;
+            if (k == peakBin + 1) peakNext = power;
+            if (power > peakPower) {
+                peakPower = power;
+                peakBin = k;
+                peakPrev = prevPower;
+                peakNext = 0;
+            }
+            prevPower = power;
+        }
+
+        // Parabolic interpolation on magnitudes around the peak bin
+        const float a = sqrtf(peakPrev);
+        const float b = sqrtf(peakPower);
+        const float c = sqrtf(peakNext);
+        const float denom = a - 2 * b + c;
+        const float delta = (denom != 0) ? 0.5f * (a - c) / denom : 0;
+        result.peakHz[axis] = (peakBin + delta) * sampleRate / N;
+        result.peakAmplitude[axis] = (b - 0.25f * (a - c) * delta) * amplitudeScale;
+    }
+
+    // Squared magnitude of real-FFT bin k (1 <= k < HALF) from the packed complex FFT
+    float binPower(const float* z, size_t k) const {
+        const size_t j = HALF - k;
+        const float zr = z[2 * k], zi = z[2 * k + 1];
+        const float cr = z[2 * j], ci = -z[2 * j + 1];
+        const float er = 0.5f * (zr + cr), ei = 0.5f * (zi + ci);
+        const float or_ = 0.5f * (zi - ci), oi = -0.5f * (zr - cr);
+        const float xr = er + twiddleRe[k] * or_ - twiddleIm[k] * oi;
+        const float xi = ei + twiddleRe[k] * oi + twiddleIm[k] * or_;
+        return xr * xr + xi * xi;
+    }
+
+    // In-place radix-2 FFT of HALF interleaved complex values
+    void fftComplex(float* z) const {
+        for (size_t i = 1, j = 0; i < HALF; i++) {
+            size_t bit = HALF >> 1;
+            for (; j & bit; bit >>= 1) j ^= bit;
+            j ^= bit;
+            if (i < j) {
+                float t = z[2 * i]; z[2 * i] = z[2 * j]; z[2 * j] = t;
+                t = z[2 * i + 1]; z[2 * i + 1] = z[2 * j + 1]; z[2 * j + 1] = t;
+            }
+        }
+        for (size_t len = 2; len <= HALF; len <<= 1) {
+            const size_t half = len >> 1;
+            const size_t step = N / len;
+            for (size_t i = 0; i < HALF; i += len) {
+                for (size_t j = 0; j < half; j++) {
+                    const float wr = twiddleRe[j * step];
+                    const float wi = twiddleIm[j * step];
+                    float* u = z + 2 * (i + j);
+                    float* v = z + 2 * (i + j + half);
+                    const float vr = v[0] * wr - v[1] * wi;
+                    const float vi = v[0] * wi + v[1] * wr;
+                    v[0] = u[0] - vr;
+                    v[1] = u[1] - vi;
+                    u[0] += vr;
+                    u[1] += vi;
+                }
+            }
+        }
+    }
+
+    float sampleRate;
+    float amplitudeScale; // Converts |X[k]| to single-sided amplitude (window coherent gain)
+    float powerScale;     // Converts |X[k]|^2 to single-sided mean-square contribution
+    float window[N];
+    float twiddleRe[HALF];
+    float twiddleIm[HALF];
+    float frame[3][N];
+    size_t fill;
+    uint32_t frames;
+    uint32_t frameTime;
+    Result result;
+};
+
+#endif // VIBRATION_SPECTRUM_H